@@ -230,13 +230,9 @@ public:
                     else
                     {
                         // leaf - test some objects
-                        int n = tree[node + 1];
-                        while (n > 0)
+                        if (intersectLeaf(r, intersectCallback, objects.data() + offset, tree[node + 1], maxDist, stopAtFirstHit, 0))
                         {
-                            bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirstHit);
-                            if (stopAtFirstHit && hit) { return; }
-                            --n;
-                            ++offset;
+                            return;
                         }
                         break;
                     }
@@ -280,6 +276,27 @@ public:
         }
     }
 
+    /* Callbacks able to test a whole leaf in one pass (e.g. several triangles with SIMD) provide
+       bool operator()(ray, entries, count, maxDist, stopAtFirstHit), returning true to end the
+       traversal. Every other callback is handed the leaf primitives one by one. */
+    template<typename RayCallback>
+    static auto intersectLeaf(const G3D::Ray& r, RayCallback& intersectCallback, uint32 const* entries, uint32 count, float& maxDist, bool stopAtFirstHit, int)
+        -> decltype(intersectCallback(r, entries, count, maxDist, stopAtFirstHit))
+    {
+        return intersectCallback(r, entries, count, maxDist, stopAtFirstHit);
+    }
+
+    template<typename RayCallback>
+    static bool intersectLeaf(const G3D::Ray& r, RayCallback& intersectCallback, uint32 const* entries, uint32 count, float& maxDist, bool stopAtFirstHit, long)
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            bool hit = intersectCallback(r, entries[i], maxDist, stopAtFirstHit);
+            if (stopAtFirstHit && hit) { return true; }
+        }
+        return false;
+    }
+
     template<typename IsectCallback>
     void intersectPoint(const G3D::Vector3& p, IsectCallback& intersectCallback) const
     {
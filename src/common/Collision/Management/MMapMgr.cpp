@@ -27,6 +27,93 @@ namespace MMAP
     static char const* const MAP_FILE_NAME_FORMAT = "%s/mmaps/%03i.mmap";
     static char const* const TILE_FILE_NAME_FORMAT = "%s/mmaps/%03i%02i%02i.mmtile";
 
+    // ######################## NavMeshPathCache ########################
+    bool NavMeshPathCache::Find(NavMeshPathKey const& key, dtPolyRef* path, uint32& pathLength, uint32 maxPathLength, uint32& generation)
+    {
+        if (!_capacity)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> guard(_lock);
+        auto itr = _index.find(key);
+        if (itr == _index.end() || itr->second->second.size() > maxPathLength)
+        {
+            generation = _generation;
+            if (_stats)
+            {
+                _stats->Misses.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            return false;
+        }
+
+        // move to front, it is the most recently used now
+        _entries.splice(_entries.begin(), _entries, itr->second);
+
+        std::vector<dtPolyRef> const& cachedPath = itr->second->second;
+        std::copy(cachedPath.begin(), cachedPath.end(), path);
+        pathLength = uint32(cachedPath.size());
+        if (_stats)
+        {
+            _stats->Hits.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return true;
+    }
+
+    void NavMeshPathCache::Store(NavMeshPathKey const& key, uint32 generation, dtPolyRef const* path, uint32 pathLength)
+    {
+        if (!_capacity || !pathLength)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(_lock);
+
+        // a tile was loaded or unloaded during the search, the path may reference polys that are gone
+        if (generation != _generation)
+        {
+            return;
+        }
+
+        auto itr = _index.find(key);
+        if (itr != _index.end())
+        {
+            itr->second->second.assign(path, path + pathLength);
+            _entries.splice(_entries.begin(), _entries, itr->second);
+            return;
+        }
+
+        // take the entry to fill from the cleared ones, then from the least recently used one
+        if (!_freeEntries.empty())
+        {
+            _entries.splice(_entries.begin(), _freeEntries, _freeEntries.begin());
+        }
+        else if (_index.size() >= _capacity)
+        {
+            _index.erase(_entries.back().first);
+            _entries.splice(_entries.begin(), _entries, std::prev(_entries.end()));
+        }
+        else
+        {
+            _entries.emplace_front();
+        }
+
+        PathEntry& entry = _entries.front();
+        entry.first = key;
+        entry.second.assign(path, path + pathLength);
+        _index.emplace(key, _entries.begin());
+    }
+
+    void NavMeshPathCache::Clear()
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _index.clear();
+        _freeEntries.splice(_freeEntries.end(), _entries);
+        ++_generation;
+    }
+
     // ######################## MMapMgr ########################
     MMapMgr::~MMapMgr()
     {
@@ -45,9 +132,11 @@ namespace MMAP
         for (const uint32& mapId : mapIds)
         {
             loadedMMaps.emplace(mapId, nullptr);
+            pathCacheStats.emplace(mapId, std::make_unique<NavMeshPathCacheStats>());
         }
 
         thread_safe_environment = false;
+        pathCacheStatsReady.store(true, std::memory_order_release);
     }
 
     MMapDataSet::const_iterator MMapMgr::GetMMapData(uint32 mapId) const
@@ -116,7 +205,8 @@ namespace MMAP
         LOG_DEBUG("maps", "MMAP:loadMapData: Loaded %03i.mmap", mapId);
 
         // store inside our map list
-        MMapData* mmap_data = new MMapData(mesh);
+        auto stats = pathCacheStats.find(mapId);
+        MMapData* mmap_data = new MMapData(mesh, sConfigMgr->GetOption<uint32>("MoveMaps.PathCacheSize", 1024), stats != pathCacheStats.end() ? stats->second.get() : nullptr);
         itr->second = mmap_data;
         return true;
     }
@@ -191,6 +281,7 @@ namespace MMAP
         if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
+            mmap->pathCache.Clear();
             ++loadedTiles;
             dtMeshHeader* header = (dtMeshHeader*)data;
             LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile %03i[%02i,%02i] into %03i[%02i,%02i]", mapId, x, y, mapId, header->x, header->y);
@@ -237,6 +328,7 @@ namespace MMAP
         }
 
         mmap->loadedTileRefs.erase(packedGridPos);
+        mmap->pathCache.Clear();
         --loadedTiles;
         LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile %03i[%02i,%02i] from %03i", mapId, x, y, mapId);
         return true;
@@ -289,6 +381,7 @@ namespace MMAP
         }
 
         MMapData* mmap = itr->second;
+        std::lock_guard<std::mutex> guard(mmap->navMeshQueriesLock);
         if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
         {
             LOG_DEBUG("maps", "MMAP:unloadMapInstance: Asked to unload not loaded dtNavMeshQuery mapId %03u instanceId %u", mapId, instanceId);
@@ -315,6 +408,17 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
+    NavMeshPathCache* MMapMgr::GetPathCache(uint32 mapId)
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+        {
+            return nullptr;
+        }
+
+        return &itr->second->pathCache;
+    }
+
     dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
     {
         MMapDataSet::const_iterator itr = GetMMapData(mapId);
@@ -324,25 +428,22 @@ namespace MMAP
         }
 
         MMapData* mmap = itr->second;
+        std::lock_guard<std::mutex> guard(mmap->navMeshQueriesLock);
         if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
         {
-            // check again after acquiring mutex
-            if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
+            // allocate mesh query
+            dtNavMeshQuery* query = dtAllocNavMeshQuery();
+            ASSERT(query);
+
+            if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
             {
-                // allocate mesh query
-                dtNavMeshQuery* query = dtAllocNavMeshQuery();
-                ASSERT(query);
-
-                if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
-                {
-                    dtFreeNavMeshQuery(query);
-                    LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId %03u instanceId %u", mapId, instanceId);
-                    return nullptr;
-                }
-
-                LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId %03u instanceId %u", mapId, instanceId);
-                mmap->navMeshQueries.insert(std::pair<uint32, dtNavMeshQuery*>(instanceId, query));
+                dtFreeNavMeshQuery(query);
+                LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId %03u instanceId %u", mapId, instanceId);
+                return nullptr;
             }
+
+            LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId %03u instanceId %u", mapId, instanceId);
+            mmap->navMeshQueries.insert(std::pair<uint32, dtNavMeshQuery*>(instanceId, query));
         }
 
         return mmap->navMeshQueries[instanceId];
@@ -22,6 +22,10 @@
 #include "DetourAlloc.h"
 #include "DetourExtended.h"
 #include "DetourNavMesh.h"
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 #include <vector>
@@ -43,10 +47,72 @@ namespace MMAP
     typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
     typedef std::unordered_map<uint32, dtNavMeshQuery*> NavMeshQuerySet;
 
+    struct NavMeshPathKey
+    {
+        dtPolyRef StartRef;
+        dtPolyRef EndRef;
+        uint16 IncludeFlags;
+        uint16 ExcludeFlags;
+
+        bool operator==(NavMeshPathKey const& right) const
+        {
+            return StartRef == right.StartRef && EndRef == right.EndRef && IncludeFlags == right.IncludeFlags && ExcludeFlags == right.ExcludeFlags;
+        }
+    };
+
+    struct NavMeshPathKeyHash
+    {
+        std::size_t operator()(NavMeshPathKey const& key) const
+        {
+            std::size_t hash = std::hash<dtPolyRef>()(key.StartRef);
+            hash ^= std::hash<dtPolyRef>()(key.EndRef) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<uint32>()(uint32(key.IncludeFlags) << 16 | key.ExcludeFlags) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    // hit and miss counters of the path cache of one map, read and reset by the metrics
+    struct NavMeshPathCacheStats
+    {
+        std::atomic<uint64> Hits{0};
+        std::atomic<uint64> Misses{0};
+    };
+
+    // LRU cache of complete poly corridors returned by dtNavMeshQuery::findPath, shared by every
+    // instance of a map. Units chasing the same target keep asking for the same corridor, the
+    // point path is still built per caller from its own start and end positions.
+    // Poly refs are only valid for the tiles they were built from, so the cache is emptied
+    // whenever a tile of the navmesh is loaded or unloaded. That also starts a new generation,
+    // a path found before it can not be stored anymore.
+    // Entries are never freed while the map is loaded, evicted and cleared ones keep their path
+    // buffer for the next corridor stored.
+    class NavMeshPathCache
+    {
+    public:
+        NavMeshPathCache(std::size_t capacity, NavMeshPathCacheStats* stats) : _capacity(capacity), _generation(0), _stats(stats) { }
+
+        // on a miss, generation receives the value to pass to Store() once the path was searched
+        bool Find(NavMeshPathKey const& key, dtPolyRef* path, uint32& pathLength, uint32 maxPathLength, uint32& generation);
+        void Store(NavMeshPathKey const& key, uint32 generation, dtPolyRef const* path, uint32 pathLength);
+        void Clear();
+
+    private:
+        typedef std::pair<NavMeshPathKey, std::vector<dtPolyRef>> PathEntry;
+        typedef std::list<PathEntry> PathEntryList;
+
+        std::mutex _lock;
+        PathEntryList _entries;     // most recently used first
+        PathEntryList _freeEntries; // cleared entries, reused before allocating new ones
+        std::unordered_map<NavMeshPathKey, PathEntryList::iterator, NavMeshPathKeyHash> _index;
+        std::size_t _capacity;
+        uint32 _generation;
+        NavMeshPathCacheStats* _stats;
+    };
+
     // dummy struct to hold map's mmap data
     struct MMapData
     {
-        MMapData(dtNavMesh* mesh) : navMesh(mesh) { }
+        MMapData(dtNavMesh* mesh, std::size_t pathCacheSize, NavMeshPathCacheStats* pathCacheStats) : navMesh(mesh), pathCache(pathCacheSize, pathCacheStats) { }
 
         ~MMapData()
         {
@@ -61,20 +127,25 @@ namespace MMAP
             }
         }
 
-        // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
+        // we have to use single dtNavMeshQuery for every instance, since those are not thread safe.
+        // A query is only used by the thread updating its instance, searches never run elsewhere,
+        // so a pool of queries shared by several threads would have no user
         NavMeshQuerySet navMeshQueries; // instanceId to query
+        std::mutex navMeshQueriesLock;  // instances of the same map are updated by different threads
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs; // maps [map grid coords] to [dtTile]
+        NavMeshPathCache pathCache;
     };
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
+    typedef std::unordered_map<uint32, std::unique_ptr<NavMeshPathCacheStats>> NavMeshPathCacheStatsSet;
 
     // singleton class
     // holds all all access to mmap loading unloading and meshes
     class MMapMgr
     {
     public:
-        MMapMgr() : loadedTiles(0), thread_safe_environment(true) { }
+        MMapMgr() : loadedTiles(0), thread_safe_environment(true), pathCacheStatsReady(false) { }
         ~MMapMgr();
 
         void InitializeThreadUnsafe(const std::vector<uint32>& mapIds);
@@ -86,6 +157,22 @@ namespace MMAP
         // the returned [dtNavMeshQuery const*] is NOT threadsafe
         dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
         dtNavMesh const* GetNavMesh(uint32 mapId);
+        NavMeshPathCache* GetPathCache(uint32 mapId);
+
+        // calls fn(mapId, NavMeshPathCacheStats&) for each map passed to InitializeThreadUnsafe, does nothing before that
+        template<class Fn>
+        void VisitPathCacheStats(Fn&& fn) const
+        {
+            if (!pathCacheStatsReady.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            for (auto const& [mapId, stats] : pathCacheStats)
+            {
+                fn(mapId, *stats);
+            }
+        }
 
         uint32 getLoadedTilesCount() const { return loadedTiles; }
         uint32 getLoadedMapsCount() const { return loadedMMaps.size(); }
@@ -98,6 +185,9 @@ namespace MMAP
         MMapDataSet loadedMMaps;
         uint32 loadedTiles;
         bool thread_safe_environment;
+        // per map id, unlike MMapData they live as long as the manager so they can be read from any thread
+        NavMeshPathCacheStatsSet pathCacheStats;
+        std::atomic<bool> pathCacheStatsReady;
     };
 }
 
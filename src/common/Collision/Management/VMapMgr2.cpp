@@ -37,6 +37,8 @@ namespace VMAP
         GetLiquidFlagsPtr = &GetLiquidFlagsDummy;
         IsVMAPDisabledForPtr = &IsVMAPDisabledForDummy;
         thread_safe_environment = true;
+        iQueryCacheSize = 0;
+        iQueryCacheStatsReady = false;
     }
 
     VMapMgr2::~VMapMgr2()
@@ -58,9 +60,11 @@ namespace VMAP
         for (const uint32& mapId : mapIds)
         {
             iInstanceMapTrees.emplace(mapId, nullptr);
+            iQueryCacheStats.emplace(mapId, std::make_unique<MapQueryCacheStats>());
         }
 
         thread_safe_environment = false;
+        iQueryCacheStatsReady.store(true, std::memory_order_release);
     }
 
     Vector3 VMapMgr2::convertPositionToInternalRep(float x, float y, float z) const
@@ -132,7 +136,8 @@ namespace VMAP
         if (!instanceTree->second)
         {
             std::string mapFileName = getMapFileName(mapId);
-            StaticMapTree* newTree = new StaticMapTree(mapId, basePath);
+            auto stats = iQueryCacheStats.find(mapId);
+            StaticMapTree* newTree = new StaticMapTree(mapId, basePath, iQueryCacheSize, stats != iQueryCacheStats.end() ? stats->second.get() : nullptr);
             if (!newTree->InitMap(mapFileName, this))
             {
                 delete newTree;
@@ -20,6 +20,9 @@
 
 #include "Common.h"
 #include "IVMapMgr.h"
+#include "MapQueryCache.h"
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -63,6 +66,7 @@ namespace VMAP
     };
 
     typedef std::unordered_map<uint32, StaticMapTree*> InstanceTreeMap;
+    typedef std::unordered_map<uint32, std::unique_ptr<MapQueryCacheStats>> QueryCacheStatsMap;
     typedef std::unordered_map<std::string, ManagedModel> ModelFileMap;
 
     enum DisableTypes
@@ -80,6 +84,10 @@ namespace VMAP
         ModelFileMap iLoadedModelFiles;
         InstanceTreeMap iInstanceMapTrees;
         bool thread_safe_environment;
+        uint32 iQueryCacheSize;
+        // per map id, unlike the trees they live as long as the manager so they can be read from any thread
+        QueryCacheStatsMap iQueryCacheStats;
+        std::atomic<bool> iQueryCacheStatsReady;
 
         // Mutex for iLoadedModelFiles
         std::mutex LoadedModelFilesLock;
@@ -101,6 +109,18 @@ namespace VMAP
         ~VMapMgr2() override;
 
         void InitializeThreadUnsafe(const std::vector<uint32>& mapIds);
+        // number of cached LoS and height results per map, applies to maps loaded afterwards
+        void SetQueryCacheSize(uint32 size) { iQueryCacheSize = size; }
+        // calls fn(mapId, MapQueryCacheStats&) for each map passed to InitializeThreadUnsafe, does nothing before that
+        template<class Fn>
+        void VisitQueryCacheStats(Fn&& fn) const
+        {
+            if (!iQueryCacheStatsReady.load(std::memory_order_acquire))
+                return;
+
+            for (auto const& [mapId, stats] : iQueryCacheStats)
+                fn(mapId, *stats);
+        }
 
         int loadMap(const char* pBasePath, unsigned int mapId, int x, int y) override;
 
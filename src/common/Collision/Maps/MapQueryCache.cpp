@@ -0,0 +1,180 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapQueryCache.h"
+#include <cmath>
+#include <cstring>
+
+namespace VMAP
+{
+    namespace
+    {
+        // internal coordinates of valid positions are well inside this range
+        constexpr float MAX_QUANTISED_COORD = 100000.0f;
+
+        // LoS entries: bit 0 marks a used slot, bit 1 holds the result, the rest is the key
+        constexpr uint64 LOS_USED = 0x1;
+        constexpr uint64 LOS_RESULT = 0x2;
+        constexpr uint64 LOS_KEY_MASK = ~uint64(0x3);
+
+        bool Quantise(float value, uint64& hash)
+        {
+            if (!std::isfinite(value) || std::fabs(value) > MAX_QUANTISED_COORD)
+                return false;
+
+            int32 steps = int32(std::floor(value * MapQueryCache::QUANTISATION_STEPS));
+            hash = (hash ^ uint32(steps)) * 0x9E3779B97F4A7C15ULL;
+            hash ^= hash >> 29;
+            return true;
+        }
+
+        uint32 FloatBits(float value)
+        {
+            uint32 bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        float BitsToFloat(uint32 bits)
+        {
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        // never 0, so an empty slot does not match any key
+        uint64 HeightCheck(uint64 key)
+        {
+            key *= 0xC2B2AE3D27D4EB4FULL;
+            return (uint64(uint32(key >> 32) | 1)) << 32;
+        }
+    }
+
+    MapQueryCacheStats::MapQueryCacheStats()
+    {
+        for (Shard& shard : _shards)
+        {
+            shard.LineOfSightHits.store(0, std::memory_order_relaxed);
+            shard.LineOfSightMisses.store(0, std::memory_order_relaxed);
+            shard.HeightHits.store(0, std::memory_order_relaxed);
+            shard.HeightMisses.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    MapQueryCacheStats::Shard& MapQueryCacheStats::GetShard()
+    {
+        static std::atomic<uint32> nextShard(0);
+        thread_local uint32 const shard = nextShard.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+        return _shards[shard];
+    }
+
+    MapQueryCacheStats::Counters MapQueryCacheStats::Take()
+    {
+        Counters counters;
+        for (Shard& shard : _shards)
+        {
+            counters.LineOfSightHits += shard.LineOfSightHits.exchange(0, std::memory_order_relaxed);
+            counters.LineOfSightMisses += shard.LineOfSightMisses.exchange(0, std::memory_order_relaxed);
+            counters.HeightHits += shard.HeightHits.exchange(0, std::memory_order_relaxed);
+            counters.HeightMisses += shard.HeightMisses.exchange(0, std::memory_order_relaxed);
+        }
+
+        return counters;
+    }
+
+    MapQueryCache::MapQueryCache(uint32 size, MapQueryCacheStats* stats) : _mask(0), _stats(stats), _generation(0)
+    {
+        if (!size)
+            return;
+
+        uint32 slots = 1;
+        while (slots < size && slots < (1u << 24))
+            slots <<= 1;
+
+        _mask = slots - 1;
+        _lineOfSight = std::make_unique<std::atomic<uint64>[]>(slots);
+        _height = std::make_unique<HeightSlot[]>(slots);
+        for (uint32 i = 0; i < slots; ++i)
+        {
+            _lineOfSight[i].store(0, std::memory_order_relaxed);
+            _height[i].Key.store(0, std::memory_order_relaxed);
+            _height[i].Value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    bool MapQueryCache::GetLineOfSightKey(G3D::Vector3 const& pos1, G3D::Vector3 const& pos2, uint64& key) const
+    {
+        if (!IsEnabled())
+            return false;
+
+        key = uint64(_generation.load(std::memory_order_acquire)) + 1;
+        return Quantise(pos1.x, key) && Quantise(pos1.y, key) && Quantise(pos1.z, key) &&
+            Quantise(pos2.x, key) && Quantise(pos2.y, key) && Quantise(pos2.z, key);
+    }
+
+    bool MapQueryCache::GetHeightKey(G3D::Vector3 const& pos, float maxSearchDist, uint64& key) const
+    {
+        if (!IsEnabled() || !std::isfinite(maxSearchDist))
+            return false;
+
+        key = (uint64(_generation.load(std::memory_order_acquire)) + 1) ^ (uint64(FloatBits(maxSearchDist)) << 32);
+        return Quantise(pos.x, key) && Quantise(pos.y, key) && Quantise(pos.z, key);
+    }
+
+    bool MapQueryCache::FindLineOfSight(uint64 key, bool& inLoS) const
+    {
+        uint64 entry = _lineOfSight[(key >> 2) & _mask].load(std::memory_order_relaxed);
+        bool hit = (entry & LOS_USED) && (entry & LOS_KEY_MASK) == (key & LOS_KEY_MASK);
+        if (hit)
+            inLoS = (entry & LOS_RESULT) != 0;
+
+        if (_stats)
+            _stats->AddLineOfSight(hit);
+
+        return hit;
+    }
+
+    void MapQueryCache::StoreLineOfSight(uint64 key, bool inLoS)
+    {
+        _lineOfSight[(key >> 2) & _mask].store((key & LOS_KEY_MASK) | LOS_USED | (inLoS ? LOS_RESULT : 0), std::memory_order_relaxed);
+    }
+
+    // Both words of a slot are written separately and may be overwritten by another thread in between.
+    // A hit needs the full key in the first word and the check value of that key in the second, so a
+    // result is never returned for another key or paired with the height of another key.
+    bool MapQueryCache::FindHeight(uint64 key, float& height) const
+    {
+        HeightSlot const& slot = _height[key & _mask];
+        uint64 value = 0;
+        bool hit = slot.Key.load(std::memory_order_acquire) == key
+            && ((value = slot.Value.load(std::memory_order_acquire)) & ~uint64(0xFFFFFFFF)) == HeightCheck(key);
+        if (hit)
+            height = BitsToFloat(uint32(value));
+
+        if (_stats)
+            _stats->AddHeight(hit);
+
+        return hit;
+    }
+
+    void MapQueryCache::StoreHeight(uint64 key, float height)
+    {
+        HeightSlot& slot = _height[key & _mask];
+        slot.Value.store(HeightCheck(key) | FloatBits(height), std::memory_order_release);
+        slot.Key.store(key, std::memory_order_release);
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAPQUERYCACHE_H
+#define _MAPQUERYCACHE_H
+
+#include "Define.h"
+#include <G3D/Vector3.h>
+#include <atomic>
+#include <memory>
+
+namespace VMAP
+{
+    /**
+    Hit and miss counters of the query cache of one map. Each thread counts in its own shard,
+    so map threads querying the same map do not contend on the counters; Take() merges the shards.
+    */
+    class MapQueryCacheStats
+    {
+    public:
+        struct Counters
+        {
+            uint64 LineOfSightHits = 0;
+            uint64 LineOfSightMisses = 0;
+            uint64 HeightHits = 0;
+            uint64 HeightMisses = 0;
+        };
+
+        MapQueryCacheStats();
+
+        void AddLineOfSight(bool hit) { (hit ? GetShard().LineOfSightHits : GetShard().LineOfSightMisses).fetch_add(1, std::memory_order_relaxed); }
+        void AddHeight(bool hit) { (hit ? GetShard().HeightHits : GetShard().HeightMisses).fetch_add(1, std::memory_order_relaxed); }
+
+        // returns the counts since the previous call
+        Counters Take();
+
+    private:
+        static constexpr uint32 SHARD_COUNT = 16;
+
+        struct alignas(64) Shard
+        {
+            std::atomic<uint64> LineOfSightHits;
+            std::atomic<uint64> LineOfSightMisses;
+            std::atomic<uint64> HeightHits;
+            std::atomic<uint64> HeightMisses;
+        };
+
+        Shard& GetShard();
+
+        Shard _shards[SHARD_COUNT];
+    };
+
+    /**
+    Lock-free, fixed size cache of line of sight and height results of one StaticMapTree.
+    Query points are quantised to QUANTISATION_STEPS per yard, entries are direct mapped and
+    simply overwritten on collision. Only static geometry goes in here, dynamic objects are
+    handled by DynamicMapTree and never cached.
+    Every load/unload of a tile starts a new generation, so older entries stop matching.
+    */
+    class MapQueryCache
+    {
+    public:
+        static constexpr float QUANTISATION_STEPS = 16.0f;
+
+        // size is rounded up to a power of two, 0 disables the cache. Hits and misses are counted in stats, if any
+        explicit MapQueryCache(uint32 size, MapQueryCacheStats* stats = nullptr);
+
+        [[nodiscard]] bool IsEnabled() const { return _mask != 0; }
+
+        // keys capture the current generation, build the key before running the real query
+        // and store with the same key. Return false if the points cannot be cached.
+        bool GetLineOfSightKey(G3D::Vector3 const& pos1, G3D::Vector3 const& pos2, uint64& key) const;
+        bool GetHeightKey(G3D::Vector3 const& pos, float maxSearchDist, uint64& key) const;
+
+        bool FindLineOfSight(uint64 key, bool& inLoS) const;
+        void StoreLineOfSight(uint64 key, bool inLoS);
+        bool FindHeight(uint64 key, float& height) const;
+        void StoreHeight(uint64 key, float height);
+
+        void Invalidate() { _generation.fetch_add(1, std::memory_order_release); }
+
+    private:
+        // the full key, and the height next to a check value of the key that pairs both words
+        struct HeightSlot
+        {
+            std::atomic<uint64> Key;
+            std::atomic<uint64> Value;
+        };
+
+        uint32 _mask;
+        MapQueryCacheStats* _stats;
+        std::unique_ptr<std::atomic<uint64>[]> _lineOfSight;
+        std::unique_ptr<HeightSlot[]> _height;
+        std::atomic<uint32> _generation;
+    };
+}
+
+#endif // _MAPQUERYCACHE_H
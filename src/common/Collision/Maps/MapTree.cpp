@@ -121,8 +121,8 @@ namespace VMAP
         return intersectionCallBack.result;
     }
 
-    StaticMapTree::StaticMapTree(uint32 mapID, const std::string& basePath)
-        : iMapID(mapID), iIsTiled(false), iTreeValues(0), iBasePath(basePath)
+    StaticMapTree::StaticMapTree(uint32 mapID, const std::string& basePath, uint32 queryCacheSize, MapQueryCacheStats* queryCacheStats)
+        : iMapID(mapID), iIsTiled(false), iTreeValues(0), iBasePath(basePath), iQueryCache(queryCacheSize, queryCacheStats)
     {
         if (iBasePath.length() > 0 && iBasePath[iBasePath.length() - 1] != '/' && iBasePath[iBasePath.length() - 1] != '\\')
         {
@@ -172,16 +172,25 @@ namespace VMAP
         {
             return true;
         }
+
+        uint64 cacheKey;
+        bool cacheable = iQueryCache.GetLineOfSightKey(pos1, pos2, cacheKey);
+        bool inLoS;
+        if (cacheable && iQueryCache.FindLineOfSight(cacheKey, inLoS))
+        {
+            return inLoS;
+        }
+
         // direction with length of 1
         G3D::Ray ray = G3D::Ray::fromOriginAndDirection(pos1, (pos2 - pos1) / maxDist);
+        inLoS = !GetIntersectionTime(ray, maxDist, true);
 
-        if (GetIntersectionTime(ray, maxDist, true))
+        if (cacheable)
         {
-
-            return false;
+            iQueryCache.StoreLineOfSight(cacheKey, inLoS);
         }
 
-        return true;
+        return inLoS;
     }
     //=========================================================
     /**
@@ -236,7 +245,15 @@ namespace VMAP
 
     float StaticMapTree::getHeight(const Vector3& pPos, float maxSearchDist) const
     {
-        float height = G3D::finf();
+        uint64 cacheKey;
+        bool cacheable = iQueryCache.GetHeightKey(pPos, maxSearchDist, cacheKey);
+        float height;
+        if (cacheable && iQueryCache.FindHeight(cacheKey, height))
+        {
+            return height;
+        }
+
+        height = G3D::finf();
         Vector3 dir = Vector3(0, 0, -1);
         G3D::Ray ray(pPos, dir);   // direction with length of 1
         float maxDist = maxSearchDist;
@@ -244,6 +261,12 @@ namespace VMAP
         {
             height = pPos.z - maxDist;
         }
+
+        if (cacheable)
+        {
+            iQueryCache.StoreHeight(cacheKey, height);
+        }
+
         return (height);
     }
 
@@ -359,6 +382,7 @@ namespace VMAP
         }
         iLoadedSpawns.clear();
         iLoadedTiles.clear();
+        iQueryCache.Invalidate();
     }
 
     //=========================================================
@@ -454,6 +478,8 @@ namespace VMAP
             iLoadedTiles[packTileID(tileX, tileY)] = false;
         }
 
+        iQueryCache.Invalidate();
+
         METRIC_EVENT("map_events", "LoadMapTile",
             "Map: " + std::to_string(iMapID) + " TileX: " + std::to_string(tileX) + " TileY: " + std::to_string(tileY));
 
@@ -523,6 +549,7 @@ namespace VMAP
             }
         }
         iLoadedTiles.erase(tile);
+        iQueryCache.Invalidate();
 
         METRIC_EVENT("map_events", "UnloadMapTile",
             "Map: " + std::to_string(iMapID) + " TileX: " + std::to_string(tileX) + " TileY: " + std::to_string(tileY));
@@ -20,6 +20,7 @@
 
 #include "BoundingIntervalHierarchy.h"
 #include "Define.h"
+#include "MapQueryCache.h"
 #include <unordered_map>
 
 namespace VMAP
@@ -55,6 +56,8 @@ namespace VMAP
         // stores <tree_index, reference_count> to invalidate tree values, unload map, and to be able to report errors
         loadedSpawnMap iLoadedSpawns;
         std::string iBasePath;
+        // results of static LoS/height queries, reset whenever the loaded geometry changes
+        mutable MapQueryCache iQueryCache;
 
     private:
         bool GetIntersectionTime(const G3D::Ray& pRay, float& pMaxDist, bool StopAtFirstHit) const;
@@ -65,7 +68,7 @@ namespace VMAP
         static void unpackTileID(uint32 ID, uint32& tileX, uint32& tileY) { tileX = ID >> 16; tileY = ID & 0xFF; }
         static bool CanLoadMap(const std::string& basePath, uint32 mapID, uint32 tileX, uint32 tileY);
 
-        StaticMapTree(uint32 mapID, const std::string& basePath);
+        StaticMapTree(uint32 mapID, const std::string& basePath, uint32 queryCacheSize = 0, MapQueryCacheStats* queryCacheStats = nullptr);
         ~StaticMapTree();
 
         [[nodiscard]] bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2) const;
@@ -20,6 +20,11 @@
 #include "ModelInstance.h"
 #include "VMapDefinitions.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VMAP_SSE_TRIANGLE_TEST
+#include <emmintrin.h>
+#endif
+
 using G3D::Vector3;
 using G3D::Ray;
 
@@ -83,6 +88,108 @@ namespace VMAP
         return false;
     }
 
+#ifdef VMAP_SSE_TRIANGLE_TEST
+    // Same test as IntersectTriangle, for four triangles at once. Each lane performs the scalar
+    // operations in the same order, so the hits and distances are identical to the scalar path.
+    static bool IntersectTriangles4(std::vector<MeshTriangle>::const_iterator triangles, uint32 const* entries, std::vector<Vector3>::const_iterator points, const G3D::Ray& ray, float& distance)
+    {
+        alignas(16) float v0[3][4];
+        alignas(16) float e1[3][4];
+        alignas(16) float e2[3][4];
+
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const MeshTriangle& tri = triangles[entries[lane]];
+            const Vector3& p0 = points[tri.idx0];
+            const Vector3 edge1 = points[tri.idx1] - p0;
+            const Vector3 edge2 = points[tri.idx2] - p0;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                v0[axis][lane] = p0[axis];
+                e1[axis][lane] = edge1[axis];
+                e2[axis][lane] = edge2[axis];
+            }
+        }
+
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        const __m128 e1x = _mm_load_ps(e1[0]), e1y = _mm_load_ps(e1[1]), e1z = _mm_load_ps(e1[2]);
+        const __m128 e2x = _mm_load_ps(e2[0]), e2y = _mm_load_ps(e2[1]), e2z = _mm_load_ps(e2[2]);
+        const __m128 dx = _mm_set1_ps(ray.direction().x), dy = _mm_set1_ps(ray.direction().y), dz = _mm_set1_ps(ray.direction().z);
+
+        // p = dir x e2, a = e1 . p
+        const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+        const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+        const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+        const __m128 a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+
+        // |a| >= EPS, ill-conditioned determinants are rejected
+        const __m128 absA = _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+        __m128 valid = _mm_cmpnlt_ps(absA, _mm_set1_ps(1e-5f));
+
+        const __m128 f = _mm_div_ps(one, a);
+        const __m128 sx = _mm_sub_ps(_mm_set1_ps(ray.origin().x), _mm_load_ps(v0[0]));
+        const __m128 sy = _mm_sub_ps(_mm_set1_ps(ray.origin().y), _mm_load_ps(v0[1]));
+        const __m128 sz = _mm_sub_ps(_mm_set1_ps(ray.origin().z), _mm_load_ps(v0[2]));
+        const __m128 u = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)));
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpnlt_ps(u, zero), _mm_cmpngt_ps(u, one)));
+
+        // q = s x e1
+        const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+        const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+        const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+        const __m128 v = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)));
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpnlt_ps(v, zero), _mm_cmpngt_ps(_mm_add_ps(u, v), one)));
+
+        const __m128 t = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)));
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(t, zero), _mm_cmplt_ps(t, _mm_set1_ps(distance))));
+
+        int hits = _mm_movemask_ps(valid);
+        if (!hits)
+        {
+            return false;
+        }
+
+        // every hit lane is closer than distance, keep the closest one
+        alignas(16) float dist[4];
+        _mm_store_ps(dist, t);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            if ((hits & (1 << lane)) && dist[lane] < distance)
+            {
+                distance = dist[lane];
+            }
+        }
+
+        return true;
+    }
+#endif
+
+    // Tests a whole BIH leaf, leaves hold up to three triangles so short batches are padded
+    // by repeating the last entry, which can not change the closest hit.
+    bool IntersectTriangles(std::vector<MeshTriangle>::const_iterator triangles, uint32 const* entries, uint32 count, std::vector<Vector3>::const_iterator points, const G3D::Ray& ray, float& distance)
+    {
+        bool hit = false;
+#ifdef VMAP_SSE_TRIANGLE_TEST
+        for (; count >= 4; count -= 4, entries += 4)
+        {
+            hit |= IntersectTriangles4(triangles, entries, points, ray, distance);
+        }
+
+        if (count > 1)
+        {
+            uint32 padded[4] = { entries[0], entries[1], entries[count - 1], entries[count - 1] };
+            return IntersectTriangles4(triangles, padded, points, ray, distance) || hit;
+        }
+#endif
+        for (; count > 0; --count, ++entries)
+        {
+            hit |= IntersectTriangle(triangles[*entries], points, ray, distance);
+        }
+        return hit;
+    }
+
     class TriBoundFunc
     {
     public:
@@ -405,6 +512,11 @@ namespace VMAP
             if (result) { hit = true; }
             return hit;
         }
+        bool operator()(const G3D::Ray& ray, uint32 const* entries, uint32 count, float& distance, bool stopAtFirstHit)
+        {
+            if (IntersectTriangles(triangles, entries, count, vertices, ray, distance)) { hit = true; }
+            return stopAtFirstHit && hit;
+        }
         std::vector<Vector3>::const_iterator vertices;
         std::vector<MeshTriangle>::const_iterator triangles;
         bool hit;
@@ -42,6 +42,10 @@ namespace VMAP
         uint32 idx2{0};
     };
 
+    bool IntersectTriangle(const MeshTriangle& tri, std::vector<G3D::Vector3>::const_iterator points, const G3D::Ray& ray, float& distance);
+    //! Tests the triangles of a BIH leaf, four at a time where SSE2 is available. Same results as IntersectTriangle for each entry.
+    bool IntersectTriangles(std::vector<MeshTriangle>::const_iterator triangles, uint32 const* entries, uint32 count, std::vector<G3D::Vector3>::const_iterator points, const G3D::Ray& ray, float& distance);
+
     class WmoLiquid
     {
     public:
@@ -20,6 +20,8 @@
 #include "Util.h"
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <openssl/bn.h>
 
 using SHA1 = Acore::Crypto::SHA1;
 using SRP6 = Acore::Crypto::SRP6;
@@ -29,6 +31,54 @@ using SRP6 = Acore::Crypto::SRP6;
 /*static*/ BigNumber const SRP6::_g(SRP6::g);
 /*static*/ BigNumber const SRP6::_N(N);
 
+namespace
+{
+    // NgHash = H(N) xor H(g), constant for the algorithm parameters
+    SHA1::Digest CalculateNgHash()
+    {
+        SHA1::Digest const NHash = SHA1::GetDigestOf(SRP6::N);
+        SHA1::Digest const gHash = SHA1::GetDigestOf(SRP6::g);
+        SHA1::Digest NgHash;
+        std::transform(NHash.begin(), NHash.end(), gHash.begin(), NgHash.begin(), std::bit_xor<>());
+        return NgHash;
+    }
+
+    // BN_CTX scratch space is not thread safe, every thread verifying logins keeps its own
+    BN_CTX* GetThreadContext()
+    {
+        thread_local std::unique_ptr<BN_CTX, decltype(&BN_CTX_free)> ctx(BN_CTX_new(), &BN_CTX_free);
+        return ctx.get();
+    }
+}
+
+/*static*/ BN_MONT_CTX* SRP6::GetMontgomeryN()
+{
+    // only depends on N, it is read only once set up and shared by all threads
+    static BN_MONT_CTX* const montN = []()
+    {
+        BN_MONT_CTX* mont = BN_MONT_CTX_new();
+        BN_MONT_CTX_set(mont, _N.BN(), GetThreadContext());
+        return mont;
+    }();
+
+    return montN;
+}
+
+/*static*/ BigNumber SRP6::ModExpN(BigNumber const& base, BigNumber const& exponent)
+{
+    BigNumber result;
+    BN_mod_exp_mont(result.BN(), base.BN(), exponent.BN(), _N.BN(), GetThreadContext(), GetMontgomeryN());
+    return result;
+}
+
+/*static*/ BigNumber SRP6::GExpModN(BigNumber const& exponent)
+{
+    // g is a single word, which has its own faster exponentiation
+    BigNumber result;
+    BN_mod_exp_mont_word(result.BN(), g[0], exponent.BN(), _N.BN(), GetThreadContext(), GetMontgomeryN());
+    return result;
+}
+
 /*static*/ std::pair<SRP6::Salt, SRP6::Verifier> SRP6::MakeRegistrationData(std::string const& username, std::string const& password)
 {
     std::pair<SRP6::Salt, SRP6::Verifier> res;
@@ -40,12 +90,12 @@ using SRP6 = Acore::Crypto::SRP6;
 /*static*/ SRP6::Verifier SRP6::CalculateVerifier(std::string const& username, std::string const& password, SRP6::Salt const& salt)
 {
     // v = g ^ H(s || H(u || ':' || p)) mod N
-    return _g.ModExp(
+    return GExpModN(
         SHA1::GetDigestOf(
             salt,
             SHA1::GetDigestOf(username, ":", password)
         )
-    ,_N).ToByteArray<32>();
+    ).ToByteArray<32>();
 }
 
 /*static*/ SessionKey SRP6::SHA1Interleave(SRP6::EphemeralKey const& S)
@@ -93,15 +143,11 @@ std::optional<SessionKey> SRP6::VerifyChallengeResponse(EphemeralKey const& A, S
     }
 
     BigNumber const u(SHA1::GetDigestOf(A, B));
-    EphemeralKey const S = (_A * (_v.ModExp(u, _N))).ModExp(_b, N).ToByteArray<32>();
+    EphemeralKey const S = ModExpN(_A * ModExpN(_v, u), _b).ToByteArray<32>();
 
     SessionKey K = SHA1Interleave(S);
 
-    // NgHash = H(N) xor H(g)
-    SHA1::Digest const NHash = SHA1::GetDigestOf(N);
-    SHA1::Digest const gHash = SHA1::GetDigestOf(g);
-    SHA1::Digest NgHash;
-    std::transform(NHash.begin(), NHash.end(), gHash.begin(), NgHash.begin(), std::bit_xor<>());
+    static SHA1::Digest const NgHash = CalculateNgHash();
 
     SHA1::Digest const ourM = SHA1::GetDigestOf(NgHash, _I, s, A, B, K);
     if (ourM == clientM)
@@ -26,6 +26,8 @@
 #include <array>
 #include <optional>
 
+struct bn_mont_ctx_st;
+
 namespace Acore::Crypto
 {
     class SRP6
@@ -67,7 +69,12 @@ namespace Acore::Crypto
         static BigNumber const _g; // a [g]enerator for the ring of integers mod N, algorithm parameter
         static BigNumber const _N; // the modulus, an algorithm parameter; all operations are mod this
 
-        static EphemeralKey _B(BigNumber const& b, BigNumber const& v) { return ((_g.ModExp(b, _N) + (v * 3)) % N).ToByteArray<EPHEMERAL_KEY_LENGTH>(); }
+        static EphemeralKey _B(BigNumber const& b, BigNumber const& v) { return ((GExpModN(b) + (v * 3)) % _N).ToByteArray<EPHEMERAL_KEY_LENGTH>(); }
+
+        /* exponentiations mod N, reusing the precomputed Montgomery context of N */
+        static BigNumber ModExpN(BigNumber const& base, BigNumber const& exponent);
+        static BigNumber GExpModN(BigNumber const& exponent);
+        static bn_mont_ctx_st* GetMontgomeryN();
 
         /* per-instantiation parameters, set on construction */
         SHA1::Digest const _I; // H(I) - the username, all uppercase
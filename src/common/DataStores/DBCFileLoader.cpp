@@ -21,69 +21,132 @@
 #include <stdlib.h>
 #include <string.h>
 
-DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
-
-bool DBCFileLoader::Load(char const* filename, char const* fmt)
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
 {
-    uint32 header;
-    if (data)
+    // Maps the whole file read-only. The pages belong to the page cache, so every process
+    // loading the same dbc files shares them instead of keeping private heap copies.
+    std::shared_ptr<unsigned char> MapFile(char const* filename, size_t& size)
     {
-        delete [] data;
-        data = nullptr;
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+        HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER fileSize;
+        HANDLE mapping = nullptr;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        CloseHandle(file);
+        if (!mapping)
+            return nullptr;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!view)
+            return nullptr;
+
+        size = size_t(fileSize.QuadPart);
+        return std::shared_ptr<unsigned char>(static_cast<unsigned char*>(view), [](unsigned char* view) { UnmapViewOfFile(view); });
+#else
+        int fd = open(filename, O_RDONLY);
+        if (fd < 0)
+            return nullptr;
+
+        struct stat fileStat;
+        void* view = MAP_FAILED;
+        if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+            view = mmap(nullptr, size_t(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+        close(fd);
+        if (view == MAP_FAILED)
+            return nullptr;
+
+        size_t mappedSize = size_t(fileStat.st_size);
+        size = mappedSize;
+        return std::shared_ptr<unsigned char>(static_cast<unsigned char*>(view), [mappedSize](unsigned char* view) { munmap(view, mappedSize); });
+#endif
     }
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    // fallback for files that can not be mapped
+    std::shared_ptr<unsigned char> ReadFile(char const* filename, size_t& size)
     {
-        return false;
-    }
+        FILE* f = fopen(filename, "rb");
+        if (!f)
+            return nullptr;
 
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(header);
+        std::shared_ptr<unsigned char> buffer;
+        if (fseek(f, 0, SEEK_END) == 0)
+        {
+            long fileSize = ftell(f);
+            if (fileSize > 0 && fseek(f, 0, SEEK_SET) == 0)
+            {
+                buffer.reset(new unsigned char[fileSize], std::default_delete<unsigned char[]>());
+                if (fread(buffer.get(), fileSize, 1, f) == 1)
+                    size = size_t(fileSize);
+                else
+                    buffer.reset();
+            }
+        }
 
-    if (header != 0x43424457)                                //'WDBC'
-    {
         fclose(f);
-        return false;
+        return buffer;
     }
 
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
+    uint32 ReadHeaderField(unsigned char const* file, uint32 index)
     {
-        fclose(f);
-        return false;
+        uint32 value;
+        memcpy(&value, file + index * sizeof(uint32), sizeof(uint32));
+        EndianConvert(value);
+        return value;
     }
+}
 
-    EndianConvert(recordCount);
+DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
+bool DBCFileLoader::Load(char const* filename, char const* fmt)
+{
+    static constexpr uint32 HeaderSize = 5 * sizeof(uint32);
+
+    _fileData.reset();
+    data = nullptr;
+    stringTable = nullptr;
+
+    size_t fileSize = 0;
+    std::shared_ptr<unsigned char> file = MapFile(filename, fileSize);
+    if (!file)
+        file = ReadFile(filename, fileSize);
+
+    if (!file || fileSize < HeaderSize)
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(fieldCount);
-
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
+    if (ReadHeaderField(file.get(), 0) != 0x43424457)       //'WDBC'
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(recordSize);
+    recordCount = ReadHeaderField(file.get(), 1);           // Number of records
+    fieldCount = ReadHeaderField(file.get(), 2);            // Number of fields
+    recordSize = ReadHeaderField(file.get(), 3);            // Size of a record
+    stringSize = ReadHeaderField(file.get(), 4);            // String size
 
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
+    if (!fieldCount || fileSize - HeaderSize < uint64(recordSize) * recordCount + stringSize)
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(stringSize);
-
+    delete[] fieldsOffset;
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -100,24 +163,15 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
         }
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    _fileData = std::move(file);
+    data = _fileData.get() + HeaderSize;
     stringTable = data + recordSize * recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
-
     delete[] fieldsOffset;
 }
 
@@ -275,16 +329,14 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     return dataTable;
 }
 
-char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
+bool DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
 {
     if (strlen(format) != fieldCount)
     {
-        return nullptr;
+        return false;
     }
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
-
+    bool usesStrings = false;
     uint32 offset = 0;
 
     for (uint32 y = 0; y < recordCount; ++y)
@@ -305,12 +357,13 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
                     break;
                 case FT_STRING:
                 {
-                    // fill only not filled entries
-                    char** slot = (char**)(&dataTable[offset]);
-                    if (!*slot || !** slot)
+                    // fill only not filled entries, strings point straight into the file
+                    char const** slot = (char const**)(&dataTable[offset]);
+                    char const* st = getRecord(y).getString(x);
+                    if (!*slot || (!**slot && *st))
                     {
-                        const char* st = getRecord(y).getString(x);
-                        *slot = stringPool + (st - (char const*)stringTable);
+                        *slot = st;
+                        usesStrings = true;
                     }
                     offset += sizeof(char*);
                     break;
@@ -329,5 +382,5 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
         }
     }
 
-    return stringPool;
+    return usesStrings;
 }
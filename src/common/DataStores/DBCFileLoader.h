@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
 
 enum DbcFieldFormat
 {
@@ -93,7 +94,10 @@ public:
     [[nodiscard]] uint32 GetOffset(size_t id) const { return (fieldsOffset != nullptr && id < fieldCount) ? fieldsOffset[id] : 0; }
     [[nodiscard]] bool IsLoaded() const { return data != nullptr; }
     char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
-    char* AutoProduceStrings(char const* fmt, char* dataTable);
+    // Points the string fields of dataTable into the file, returns whether any string was taken from it
+    bool AutoProduceStrings(char const* fmt, char* dataTable);
+    // Keeps the file contents alive after the loader is gone, strings from AutoProduceStrings point into them
+    [[nodiscard]] std::shared_ptr<void const> GetFileData() const { return _fileData; }
     static uint32 GetFormatRecordSize(const char* format, int32* index_pos = nullptr);
 
 private:
@@ -102,6 +106,7 @@ private:
     uint32 fieldCount;
     uint32 stringSize;
     uint32* fieldsOffset;
+    std::shared_ptr<unsigned char> _fileData;               // mapped read-only when possible
     unsigned char* data;
     unsigned char* stringTable;
 
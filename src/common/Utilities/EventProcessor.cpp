@@ -43,12 +43,11 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (m_head && m_head->m_execTime <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        BasicEvent* event = m_head;
+        Unlink(event);
 
         if (event->IsRunning())
         {
@@ -82,55 +81,94 @@ void EventProcessor::Update(uint32 p_time)
 void EventProcessor::KillAllEvents(bool force)
 {
     // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    for (BasicEvent* event = m_head; event;)
     {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
+        BasicEvent* next = event->m_next;
+
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
+        if (!force && !event->IsDeletable())
         {
-            ++itr;
+            event = next;
             continue;
         }
 
-        delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        Unlink(event);
+        delete event;
+        event = next;
     }
-
-    if (force)
-        m_events.clear();
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
 {
     if (set_addtime)
         Event->m_addTime = m_time;
+    ASSERT(!Event->m_owner || Event->m_owner == this);
+
+    // adding an already queued event again only moves it
+    if (Event->m_owner)
+        Unlink(Event);
+
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    Link(Event);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    if (event->m_owner != this)
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
-        break;
-    }
+    Unlink(event);
+    event->m_execTime = newTime.count();
+    Link(event);
+}
+
+void EventProcessor::Link(BasicEvent* event)
+{
+    // events are mostly added at increasing times, so the insert position is searched from the back
+    BasicEvent* prev = m_tail;
+    while (prev && prev->m_execTime > event->m_execTime)
+        prev = prev->m_prev;
+
+    BasicEvent* next = prev ? prev->m_next : m_head;
+
+    event->m_owner = this;
+    event->m_prev = prev;
+    event->m_next = next;
+
+    if (prev)
+        prev->m_next = event;
+    else
+        m_head = event;
+
+    if (next)
+        next->m_prev = event;
+    else
+        m_tail = event;
+}
+
+void EventProcessor::Unlink(BasicEvent* event)
+{
+    if (event->m_prev)
+        event->m_prev->m_next = event->m_next;
+    else
+        m_head = event->m_next;
+
+    if (event->m_next)
+        event->m_next->m_prev = event->m_prev;
+    else
+        m_tail = event->m_prev;
+
+    event->m_owner = nullptr;
+    event->m_prev = nullptr;
+    event->m_next = nullptr;
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
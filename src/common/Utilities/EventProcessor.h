@@ -23,8 +23,8 @@
 #include "Random.h"
 
 #include "advstd.h"
-#include <map>
 #include <type_traits>
+#include <utility>
 
 class EventProcessor;
 
@@ -43,7 +43,7 @@ class BasicEvent
 
     public:
         BasicEvent()
-            : m_abortState(AbortState::STATE_RUNNING), m_addTime(0), m_execTime(0) { }
+            : m_abortState(AbortState::STATE_RUNNING), m_addTime(0), m_execTime(0), m_owner(nullptr), m_prev(nullptr), m_next(nullptr) { }
 
         virtual ~BasicEvent() { } // override destructor to perform some actions on event removal
 
@@ -70,6 +70,11 @@ class BasicEvent
         // these can be used for time offset control
         uint64 m_addTime;                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
+
+        // intrusive links of the event queue, so queueing, rescheduling and removal need no allocation
+        EventProcessor* m_owner;                            // processor the event is queued in, nullptr if none
+        BasicEvent* m_prev;
+        BasicEvent* m_next;
 };
 
 template<typename T>
@@ -92,12 +97,10 @@ class LambdaBasicEvent : public BasicEvent
 template<typename T>
 using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::remove_pointer_t<advstd::remove_cvref_t<T>>>>;
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
-
 class EventProcessor
 {
     public:
-        EventProcessor() : m_time(0) { }
+        EventProcessor() : m_time(0), m_head(nullptr), m_tail(nullptr) { }
         ~EventProcessor();
 
         void Update(uint32 p_time);
@@ -118,9 +121,14 @@ class EventProcessor
         [[nodiscard]] uint64 CalculateQueueTime(uint64 delay) const;
 
     protected:
+        void Link(BasicEvent* event);
+        void Unlink(BasicEvent* event);
+
         uint64 m_time;
-        EventList m_events;
-        bool m_aborting;
+
+        // queued events ordered by execution time, events with equal time in the order they were added
+        BasicEvent* m_head;
+        BasicEvent* m_tail;
 };
 
 #endif
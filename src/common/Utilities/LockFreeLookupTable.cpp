@@ -0,0 +1,101 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LockFreeLookupTable.h"
+
+namespace
+{
+    // one per thread that ever did a lookup, never freed and reused after the thread exits
+    struct ReaderRecord
+    {
+        std::atomic<uint64> Epoch{ 0 };                     // 0 while the thread is not in a lookup
+        std::atomic<bool> InUse{ false };
+        ReaderRecord* Next = nullptr;
+    };
+
+    std::atomic<uint64> GlobalEpoch{ 1 };
+    std::atomic<ReaderRecord*> Records{ nullptr };
+
+    ReaderRecord* AcquireRecord()
+    {
+        for (ReaderRecord* record = Records.load(std::memory_order_acquire); record; record = record->Next)
+            if (!record->InUse.load(std::memory_order_relaxed) && !record->InUse.exchange(true, std::memory_order_acquire))
+                return record;
+
+        ReaderRecord* record = new ReaderRecord();
+        record->InUse.store(true, std::memory_order_relaxed);
+        record->Next = Records.load(std::memory_order_relaxed);
+        while (!Records.compare_exchange_weak(record->Next, record, std::memory_order_release, std::memory_order_relaxed))
+            ;
+
+        return record;
+    }
+
+    struct ThreadReader
+    {
+        ThreadReader() : Record(AcquireRecord()), Depth(0) { }
+
+        ~ThreadReader()
+        {
+            Record->Epoch.store(0, std::memory_order_release);
+            Record->InUse.store(false, std::memory_order_release);
+        }
+
+        ReaderRecord* Record;
+        uint32 Depth;
+    };
+
+    thread_local ThreadReader Reader;
+}
+
+Acore::LookupTableEpoch::ReadGuard::ReadGuard()
+{
+    if (Reader.Depth++ == 0)
+    {
+        Reader.Record->Epoch.store(GlobalEpoch.load(std::memory_order_acquire), std::memory_order_seq_cst);
+
+        // pairs with the fence in IsQuiescent: either the writer sees this record or this thread sees everything
+        // the writer unpublished before it
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+Acore::LookupTableEpoch::ReadGuard::~ReadGuard()
+{
+    if (--Reader.Depth == 0)
+        Reader.Record->Epoch.store(0, std::memory_order_release);
+}
+
+uint64 Acore::LookupTableEpoch::Retire()
+{
+    // the caller unpublished the object before this, so a lookup that reads the advanced epoch can't reach it
+    return GlobalEpoch.fetch_add(1, std::memory_order_seq_cst);
+}
+
+bool Acore::LookupTableEpoch::IsQuiescent(uint64 epoch)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    for (ReaderRecord* record = Records.load(std::memory_order_acquire); record; record = record->Next)
+    {
+        uint64 readerEpoch = record->Epoch.load(std::memory_order_seq_cst);
+        if (readerEpoch && readerEpoch <= epoch)
+            return false;
+    }
+
+    return true;
+}
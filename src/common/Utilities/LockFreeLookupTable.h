@@ -0,0 +1,245 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_LOCK_FREE_LOOKUP_TABLE_H
+#define ACORE_LOCK_FREE_LOOKUP_TABLE_H
+
+#include "Define.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Acore
+{
+    /*
+     * Epoch based reclamation for the lock free lookup tables. A lookup holds a ReadGuard, which
+     * publishes the global epoch it started in for its thread. A writer stamps what it retires with
+     * Retire() and may free it once IsQuiescent() reports that no lookup from that epoch or earlier
+     * is still running. Readers only ever write their own thread's record. Guards nest, a caller that
+     * has to read the object a lookup returned holds its own guard around both.
+     */
+    class AC_COMMON_API LookupTableEpoch
+    {
+    public:
+        class AC_COMMON_API ReadGuard
+        {
+        public:
+            ReadGuard();
+            ~ReadGuard();
+
+            ReadGuard(ReadGuard const&) = delete;
+            ReadGuard& operator=(ReadGuard const&) = delete;
+        };
+
+        // advances the global epoch and returns the epoch the retired object belongs to
+        static uint64 Retire();
+
+        // true once every lookup that could still see an object retired in epoch has finished
+        static bool IsQuiescent(uint64 epoch);
+    };
+
+    /*
+     * Open addressing hash table of uint64 keys to T* whose lookups take no lock and never wait,
+     * while one writer at a time inserts and erases. Writers must be serialised by the caller.
+     * Keys 0 and ~0 are reserved.
+     *
+     * Erased slots become tombstones. When live entries and tombstones fill half of the table it is
+     * rebuilt into a new one, and the old one is freed by a later rebuild once every lookup that
+     * could have started on it has finished (see LookupTableEpoch).
+     */
+    template<class T>
+    class LockFreeLookupTable
+    {
+        static constexpr uint64 EMPTY_KEY = 0;
+        static constexpr uint64 TOMBSTONE_KEY = ~uint64(0);
+        static constexpr std::size_t MIN_CAPACITY = 64;
+
+        struct Slot
+        {
+            std::atomic<uint64> Key{ EMPTY_KEY };
+            std::atomic<T*> Value{ nullptr };
+        };
+
+        struct Table
+        {
+            explicit Table(std::size_t capacity) : Mask(capacity - 1), Slots(new Slot[capacity]) { }
+
+            std::size_t Mask;
+            std::unique_ptr<Slot[]> Slots;
+        };
+
+    public:
+        LockFreeLookupTable() : _current(new Table(MIN_CAPACITY)), _table(_current.get()), _used(0), _size(0) { }
+
+        LockFreeLookupTable(LockFreeLookupTable const&) = delete;
+        LockFreeLookupTable& operator=(LockFreeLookupTable const&) = delete;
+
+        [[nodiscard]] T* Find(uint64 key) const
+        {
+            LookupTableEpoch::ReadGuard guard;
+
+            // ordered after the guard publishes its epoch, so a table retired before it can't be seen
+            Table const* table = _table.load(std::memory_order_seq_cst);
+            std::size_t index = Hash(key) & table->Mask;
+            for (std::size_t probes = 0; probes <= table->Mask; ++probes, index = (index + 1) & table->Mask)
+            {
+                Slot const& slot = table->Slots[index];
+                uint64 slotKey = slot.Key.load(std::memory_order_acquire);
+                if (slotKey == key)
+                {
+                    T* value = slot.Value.load(std::memory_order_acquire);
+
+                    // the slot may have been erased and reused between both loads
+                    if (slot.Key.load(std::memory_order_acquire) != key)
+                        return nullptr;
+
+                    return value;
+                }
+
+                if (slotKey == EMPTY_KEY)
+                    break;
+            }
+
+            return nullptr;
+        }
+
+        // Writer side
+
+        void Insert(uint64 key, T* value)
+        {
+            if ((_used + 1) * 2 > _current->Mask + 1)
+                Rebuild();
+
+            Table* table = _current.get();
+            Slot* freeSlot = nullptr;
+            std::size_t index = Hash(key) & table->Mask;
+            for (std::size_t probes = 0; probes <= table->Mask; ++probes, index = (index + 1) & table->Mask)
+            {
+                Slot& slot = table->Slots[index];
+                uint64 slotKey = slot.Key.load(std::memory_order_relaxed);
+                if (slotKey == key)
+                {
+                    slot.Value.store(value, std::memory_order_release);
+                    return;
+                }
+
+                if (slotKey == TOMBSTONE_KEY && !freeSlot)
+                    freeSlot = &slot;
+                else if (slotKey == EMPTY_KEY)
+                {
+                    if (!freeSlot)
+                    {
+                        freeSlot = &slot;
+                        ++_used;
+                    }
+                    break;
+                }
+            }
+
+            // value goes first, a lookup that sees the key must also see the value
+            freeSlot->Value.store(value, std::memory_order_release);
+            freeSlot->Key.store(key, std::memory_order_release);
+            ++_size;
+        }
+
+        void Erase(uint64 key)
+        {
+            Table* table = _current.get();
+            std::size_t index = Hash(key) & table->Mask;
+            for (std::size_t probes = 0; probes <= table->Mask; ++probes, index = (index + 1) & table->Mask)
+            {
+                Slot& slot = table->Slots[index];
+                uint64 slotKey = slot.Key.load(std::memory_order_relaxed);
+                if (slotKey == key)
+                {
+                    slot.Value.store(nullptr, std::memory_order_release);
+                    slot.Key.store(TOMBSTONE_KEY, std::memory_order_release);
+                    --_size;
+                    return;
+                }
+
+                if (slotKey == EMPTY_KEY)
+                    return;
+            }
+        }
+
+        [[nodiscard]] std::size_t Size() const { return _size; }
+
+        // frees the retired tables no lookup can still be reading
+        void Reclaim()
+        {
+            _retired.erase(std::remove_if(_retired.begin(), _retired.end(), [](std::pair<uint64, std::unique_ptr<Table>> const& retired)
+            {
+                return LookupTableEpoch::IsQuiescent(retired.first);
+            }), _retired.end());
+        }
+
+        [[nodiscard]] std::size_t RetiredCount() const { return _retired.size(); }
+
+    private:
+        static std::size_t Hash(uint64 key)
+        {
+            // murmur3 finalizer, guids differ mostly in their low bits
+            key ^= key >> 33;
+            key *= 0xFF51AFD7ED558CCDULL;
+            key ^= key >> 33;
+            return std::size_t(key);
+        }
+
+        void Rebuild()
+        {
+            std::size_t capacity = MIN_CAPACITY;
+            while (capacity < (_size + 1) * 4)
+                capacity *= 2;
+
+            std::unique_ptr<Table> table = std::make_unique<Table>(capacity);
+            for (std::size_t i = 0; i <= _current->Mask; ++i)
+            {
+                Slot const& slot = _current->Slots[i];
+                uint64 key = slot.Key.load(std::memory_order_relaxed);
+                if (key == EMPTY_KEY || key == TOMBSTONE_KEY)
+                    continue;
+
+                std::size_t index = Hash(key) & table->Mask;
+                while (table->Slots[index].Key.load(std::memory_order_relaxed) != EMPTY_KEY)
+                    index = (index + 1) & table->Mask;
+
+                table->Slots[index].Value.store(slot.Value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                table->Slots[index].Key.store(key, std::memory_order_relaxed);
+            }
+
+            // must be visible before the epoch advances, see LookupTableEpoch::Retire
+            _table.store(table.get(), std::memory_order_seq_cst);
+
+            Reclaim();
+
+            _retired.emplace_back(LookupTableEpoch::Retire(), std::move(_current));
+            _current = std::move(table);
+            _used = _size;
+        }
+
+        std::unique_ptr<Table> _current;
+        std::atomic<Table*> _table;
+        std::vector<std::pair<uint64, std::unique_ptr<Table>>> _retired;   // tables still readable, by retire epoch
+        std::size_t _used;                                  // slots that are not empty, tombstones included
+        std::size_t _size;
+    };
+}
+
+#endif
@@ -0,0 +1,194 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_STABLE_PTR_VECTOR_H
+#define ACORE_STABLE_PTR_VECTOR_H
+
+#include "Define.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace Acore
+{
+    /*
+     * Contiguous replacement for std::list<T*> that keeps the list iteration guarantees:
+     * iterators are index based, so push_back() never invalidates them, and remove() only
+     * nulls the slot of the removed element, which iteration then skips.
+     *
+     * Nulled slots are reclaimed by compact(), which must only be called when no iteration
+     * over the container can be in progress.
+     */
+    template<class T>
+    class StablePtrVector
+    {
+        typedef std::vector<T*> StorageType;
+
+    public:
+        typedef T* value_type;
+        typedef std::size_t size_type;
+
+        class const_iterator
+        {
+            friend class StablePtrVector;
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T*;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T* const*;
+            using reference = T* const&;
+
+            const_iterator() : _owner(nullptr), _index(0), _isEnd(false) { }
+
+            reference operator*() const { return _owner->_elements[_index]; }
+            pointer operator->() const { return &_owner->_elements[_index]; }
+
+            const_iterator& operator++()
+            {
+                _index = _owner->NextValid(_index + 1);
+                _isEnd = false;
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                const_iterator itr = *this;
+                ++(*this);
+                return itr;
+            }
+
+            const_iterator& operator--()
+            {
+                _index = _owner->PrevValid(std::min(_index, _owner->_elements.size()));
+                _isEnd = false;
+                return *this;
+            }
+
+            const_iterator operator--(int)
+            {
+                const_iterator itr = *this;
+                --(*this);
+                return itr;
+            }
+
+            // An end() iterator obtained before elements were appended still compares equal to
+            // every position at or past it, so loops caching end() do not run off the storage
+            friend bool operator==(const_iterator const& left, const_iterator const& right)
+            {
+                if (left._isEnd && right._isEnd)
+                    return true;
+
+                if (left._isEnd)
+                    return right._index >= left.EndIndex();
+
+                if (right._isEnd)
+                    return left._index >= right.EndIndex();
+
+                return left._index == right._index;
+            }
+
+            friend bool operator!=(const_iterator const& left, const_iterator const& right) { return !(left == right); }
+
+        private:
+            const_iterator(StablePtrVector const* owner, size_type index, bool isEnd) : _owner(owner), _index(index), _isEnd(isEnd) { }
+
+            [[nodiscard]] size_type EndIndex() const { return std::min(_index, _owner->_elements.size()); }
+
+            StablePtrVector const* _owner;
+            size_type _index;
+            bool _isEnd;
+        };
+
+        typedef const_iterator iterator;
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+        typedef const_reverse_iterator reverse_iterator;
+
+        StablePtrVector() : _size(0) { }
+
+        [[nodiscard]] const_iterator begin() const { return const_iterator(this, NextValid(0), false); }
+        [[nodiscard]] const_iterator end() const { return const_iterator(this, _elements.size(), true); }
+        [[nodiscard]] const_iterator cbegin() const { return begin(); }
+        [[nodiscard]] const_iterator cend() const { return end(); }
+        [[nodiscard]] const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        [[nodiscard]] const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        [[nodiscard]] bool empty() const { return _size == 0; }
+        [[nodiscard]] size_type size() const { return _size; }
+
+        [[nodiscard]] T* front() const { return *begin(); }
+        [[nodiscard]] T* back() const { return *rbegin(); }
+
+        void push_back(T* value)
+        {
+            _elements.push_back(value);
+            ++_size;
+        }
+
+        // removes every occurrence of value, like std::list::remove
+        void remove(T* value)
+        {
+            for (T*& element : _elements)
+            {
+                if (element == value)
+                {
+                    element = nullptr;
+                    --_size;
+                }
+            }
+
+            // trailing holes can be dropped right away, no index of a live element changes
+            while (!_elements.empty() && !_elements.back())
+                _elements.pop_back();
+        }
+
+        void clear()
+        {
+            _elements.clear();
+            _size = 0;
+        }
+
+        [[nodiscard]] bool NeedsCompaction() const { return _elements.size() != _size; }
+
+        void compact()
+        {
+            if (NeedsCompaction())
+                _elements.erase(std::remove(_elements.begin(), _elements.end(), nullptr), _elements.end());
+        }
+
+    private:
+        [[nodiscard]] size_type NextValid(size_type index) const
+        {
+            while (index < _elements.size() && !_elements[index])
+                ++index;
+
+            return index;
+        }
+
+        [[nodiscard]] size_type PrevValid(size_type index) const
+        {
+            while (index > 0 && !_elements[--index]) { }
+
+            return index;
+        }
+
+        StorageType _elements;
+        size_type _size;
+    };
+}
+
+#endif
@@ -109,19 +109,22 @@ void TaskScheduler::Dispatch(success_t const& callback)
 
 void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    container.insert(task);
+    task->_sequence = ++sequence;
+    container.push_back(std::move(task));
+    std::push_heap(container.begin(), container.end(), HeapCompare());
 }
 
 auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
+    std::pop_heap(container.begin(), container.end(), HeapCompare());
+    TaskContainer result = std::move(container.back());
+    container.pop_back();
     return result;
 }
 
 auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
 {
-    return *container.begin();
+    return container.front();
 }
 
 void TaskScheduler::TaskQueue::Clear()
@@ -131,32 +134,36 @@ void TaskScheduler::TaskQueue::Clear()
 
 void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            itr = container.erase(itr);
-        }
-        else
-        {
-            ++itr;
-        }
+    auto const itr = std::remove_if(container.begin(), container.end(), filter);
+    if (itr == container.end())
+    {
+        return;
+    }
+
+    container.erase(itr, container.end());
+    std::make_heap(container.begin(), container.end(), HeapCompare());
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else
+    // Visit the tasks in their execution order, modified tasks are queued again
+    // behind the tasks which already share their new end.
+    std::sort(container.begin(), container.end(), Compare());
+
+    bool modified = false;
+    for (TaskContainer const& task : container)
+    {
+        if (filter(task))
         {
-            ++itr;
+            task->_sequence = ++sequence;
+            modified = true;
         }
+    }
 
-    container.insert(cache.begin(), cache.end());
+    if (modified)
+    {
+        std::make_heap(container.begin(), container.end(), HeapCompare());
+    }
 }
 
 bool TaskScheduler::TaskQueue::IsEmpty() const
@@ -164,16 +171,6 @@ bool TaskScheduler::TaskQueue::IsEmpty() const
     return container.empty();
 }
 
-TaskContext& TaskContext::Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply)
-{
-    if (auto const owner = _owner.lock())
-    {
-        apply(*owner);
-    }
-
-    return *this;
-}
-
 bool TaskContext::IsExpired() const
 {
     return _owner.expired();
@@ -225,7 +222,7 @@ void TaskContext::AssertOnConsumed() const
 {
     // This was adapted to TC to prevent static analysis tools from complaining.
     // If you encounter this assertion check if you repeat a TaskContext more then 1 time!
-    ASSERT(!(*_consumed) && "Bad task logic, task context was consumed already!");
+    ASSERT(!IsConsumed() && "Bad task logic, task context was consumed already!");
 }
 
 void TaskContext::Invoke()
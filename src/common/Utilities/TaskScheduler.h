@@ -13,7 +13,6 @@
 #include <memory>
 #include <optional>
 #include <queue>
-#include <set>
 #include <utility>
 #include <vector>
 
@@ -62,16 +61,21 @@ class TaskScheduler
         std::optional<group_t> _group;
         repeated_t _repeated;
         task_handler_t _task;
+        uint64 _sequence;       // queue insertion order, keeps tasks with equal end in FIFO order
+        uint32 _dispatched;     // invocation counter, identifies the current TaskContext
+        bool _consumed;         // the current TaskContext was consumed
 
     public:
         // All Argument construct
         Task(timepoint_t const& end, duration_t const& duration, std::optional<group_t> const& group,
-             repeated_t const repeated, task_handler_t const& task)
-            : _end(end), _duration(duration), _group(group), _repeated(repeated), _task(task) { }
+             repeated_t const repeated, task_handler_t&& task)
+            : _end(end), _duration(duration), _group(group), _repeated(repeated), _task(std::move(task)),
+            _sequence(0), _dispatched(0), _consumed(false) { }
 
         // Minimal Argument construct
-        Task(timepoint_t const& end, duration_t const& duration, task_handler_t const& task)
-            : _end(end), _duration(duration), _group(std::nullopt), _repeated(0), _task(task) { }
+        Task(timepoint_t const& end, duration_t const& duration, task_handler_t&& task)
+            : _end(end), _duration(duration), _group(std::nullopt), _repeated(0), _task(std::move(task)),
+            _sequence(0), _dispatched(0), _consumed(false) { }
 
         // Copy construct
         Task(Task const&) = delete;
@@ -82,15 +86,15 @@ class TaskScheduler
         // Move Assign
         Task& operator= (Task&& right) = delete;
 
-        // Order tasks by its end
+        // Order tasks by its end, tasks with the same end in their queue order
         inline bool operator< (Task const& other) const
         {
-            return _end < other._end;
+            return _end < other._end || (_end == other._end && _sequence < other._sequence);
         }
 
         inline bool operator> (Task const& other) const
         {
-            return _end > other._end;
+            return other < *this;
         }
 
         // Compare tasks with its end
@@ -117,9 +121,20 @@ class TaskScheduler
         };
     };
 
+    /// Min heap on a flat vector, pushing and popping tasks reuses its storage instead of allocating nodes.
     class TaskQueue
     {
-        std::multiset<TaskContainer, Compare> container;
+        // heap order is reversed by the comparator, so the earliest task is in front
+        struct HeapCompare
+        {
+            bool operator() (TaskContainer const& left, TaskContainer const& right) const
+            {
+                return (*right.get()) < (*left.get());
+            };
+        };
+
+        std::vector<TaskContainer> container;
+        uint64 sequence = 0;
 
     public:
         // Pushes the task in the container
@@ -215,27 +230,27 @@ public:
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
     template<class _Rep, class _Period>
     TaskScheduler& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                            task_handler_t const& task)
+                            task_handler_t task)
     {
-        return ScheduleAt(_now, time, task);
+        return ScheduleAt(_now, time, std::move(task));
     }
 
     /// Schedule an event with a fixed rate.
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
     template<class _Rep, class _Period>
     TaskScheduler& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                            group_t const group, task_handler_t const& task)
+                            group_t const group, task_handler_t task)
     {
-        return ScheduleAt(_now, time, group, task);
+        return ScheduleAt(_now, time, group, std::move(task));
     }
 
     /// Schedule an event with a randomized rate between min and max rate.
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
     template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
     TaskScheduler& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
-                            std::chrono::duration<_RepRight, _PeriodRight> const& max, task_handler_t const& task)
+                            std::chrono::duration<_RepRight, _PeriodRight> const& max, task_handler_t task)
     {
-        return Schedule(RandomDurationBetween(min, max), task);
+        return Schedule(RandomDurationBetween(min, max), std::move(task));
     }
 
     /// Schedule an event with a fixed rate.
@@ -243,9 +258,9 @@ public:
     template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
     TaskScheduler& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
                             std::chrono::duration<_RepRight, _PeriodRight> const& max, group_t const group,
-                            task_handler_t const& task)
+                            task_handler_t task)
     {
-        return Schedule(RandomDurationBetween(min, max), group, task);
+        return Schedule(RandomDurationBetween(min, max), group, std::move(task));
     }
 
     /// Cancels all tasks.
@@ -364,9 +379,9 @@ private:
 
     template<class _Rep, class _Period>
     TaskScheduler& ScheduleAt(timepoint_t const& end,
-                              std::chrono::duration<_Rep, _Period> const& time, task_handler_t const& task)
+                              std::chrono::duration<_Rep, _Period> const& time, task_handler_t&& task)
     {
-        return InsertTask(TaskContainer(new Task(end + time, time, task)));
+        return InsertTask(std::make_shared<Task>(end + time, time, std::move(task)));
     }
 
     /// Schedule an event with a fixed rate.
@@ -374,10 +389,10 @@ private:
     template<class _Rep, class _Period>
     TaskScheduler& ScheduleAt(timepoint_t const& end,
                               std::chrono::duration<_Rep, _Period> const& time,
-                              group_t const group, task_handler_t const& task)
+                              group_t const group, task_handler_t&& task)
     {
         static repeated_t const DEFAULT_REPEATED = 0;
-        return InsertTask(TaskContainer(new Task(end + time, time, group, DEFAULT_REPEATED, task)));
+        return InsertTask(std::make_shared<Task>(end + time, time, group, DEFAULT_REPEATED, std::move(task)));
     }
 
     // Returns a random duration between min and max
@@ -406,35 +421,48 @@ class TaskContext
     /// Owner
     std::weak_ptr<TaskScheduler> _owner;
 
-    /// Marks the task as consumed
-    std::shared_ptr<bool> _consumed;
+    /// Invocation of the task this context belongs to, copies of the context share
+    /// the consumed state through the task instead of allocating a shared flag
+    uint32 _dispatch;
 
     /// Dispatches an action safe on the TaskScheduler
-    TaskContext& Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply);
+    template<typename Apply>
+    TaskContext& Dispatch(Apply&& apply)
+    {
+        if (auto const owner = _owner.lock())
+        {
+            apply(*owner);
+        }
+
+        return *this;
+    }
 
 public:
     // Empty constructor
     TaskContext()
-        : _task(), _owner(), _consumed(std::make_shared<bool>(true)) { }
+        : _task(), _owner(), _dispatch(0) { }
 
     // Construct from task and owner
     explicit TaskContext(TaskScheduler::TaskContainer&& task, std::weak_ptr<TaskScheduler>&& owner)
-        : _task(task), _owner(owner), _consumed(std::make_shared<bool>(false)) { }
+        : _task(std::move(task)), _owner(std::move(owner)), _dispatch(++_task->_dispatched)
+    {
+        _task->_consumed = false;
+    }
 
     // Copy construct
     TaskContext(TaskContext const& right)
-        : _task(right._task), _owner(right._owner), _consumed(right._consumed) { }
+        : _task(right._task), _owner(right._owner), _dispatch(right._dispatch) { }
 
     // Move construct
     TaskContext(TaskContext&& right)
-        : _task(std::move(right._task)), _owner(std::move(right._owner)), _consumed(std::move(right._consumed)) { }
+        : _task(std::move(right._task)), _owner(std::move(right._owner)), _dispatch(right._dispatch) { }
 
     // Copy assign
     TaskContext& operator= (TaskContext const& right)
     {
         _task = right._task;
         _owner = right._owner;
-        _consumed = right._consumed;
+        _dispatch = right._dispatch;
         return *this;
     }
 
@@ -443,7 +471,7 @@ public:
     {
         _task = std::move(right._task);
         _owner = std::move(right._owner);
-        _consumed = std::move(right._consumed);
+        _dispatch = right._dispatch;
         return *this;
     }
 
@@ -475,8 +503,11 @@ public:
         _task->_duration = duration;
         _task->_end += duration;
         _task->_repeated += 1;
-        (*_consumed) = true;
-        return Dispatch(std::bind(&TaskScheduler::InsertTask, std::placeholders::_1, _task));
+        _task->_consumed = true;
+        return Dispatch([this](TaskScheduler& scheduler) -> TaskScheduler&
+        {
+            return scheduler.InsertTask(_task);
+        });
     }
 
     /// Repeats the event with the same duration.
@@ -508,12 +539,12 @@ public:
     /// which will be called at the next update tick.
     template<class _Rep, class _Period>
     TaskContext& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                          TaskScheduler::task_handler_t const& task)
+                          TaskScheduler::task_handler_t task)
     {
         auto const end = _task->_end;
-        return Dispatch([end, time, task](TaskScheduler & scheduler) -> TaskScheduler &
+        return Dispatch([end, time, &task](TaskScheduler & scheduler) -> TaskScheduler &
         {
-            return scheduler.ScheduleAt<_Rep, _Period>(end, time, task);
+            return scheduler.ScheduleAt<_Rep, _Period>(end, time, std::move(task));
         });
     }
 
@@ -523,12 +554,12 @@ public:
     /// which will be called at the next update tick.
     template<class _Rep, class _Period>
     TaskContext& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                          TaskScheduler::group_t const group, TaskScheduler::task_handler_t const& task)
+                          TaskScheduler::group_t const group, TaskScheduler::task_handler_t task)
     {
         auto const end = _task->_end;
-        return Dispatch([end, time, group, task](TaskScheduler & scheduler) -> TaskScheduler &
+        return Dispatch([end, time, group, &task](TaskScheduler & scheduler) -> TaskScheduler &
         {
-            return scheduler.ScheduleAt<_Rep, _Period>(end, time, group, task);
+            return scheduler.ScheduleAt<_Rep, _Period>(end, time, group, std::move(task));
         });
     }
 
@@ -538,9 +569,9 @@ public:
     /// which will be called at the next update tick.
     template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
     TaskContext& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
-                          std::chrono::duration<_RepRight, _PeriodRight> const& max, TaskScheduler::task_handler_t const& task)
+                          std::chrono::duration<_RepRight, _PeriodRight> const& max, TaskScheduler::task_handler_t task)
     {
-        return Schedule(TaskScheduler::RandomDurationBetween(min, max), task);
+        return Schedule(TaskScheduler::RandomDurationBetween(min, max), std::move(task));
     }
 
     /// Schedule an event with a randomized rate between min and max rate from within the context.
@@ -550,9 +581,9 @@ public:
     template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
     TaskContext& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
                           std::chrono::duration<_RepRight, _PeriodRight> const& max, TaskScheduler::group_t const group,
-                          TaskScheduler::task_handler_t const& task)
+                          TaskScheduler::task_handler_t task)
     {
-        return Schedule(TaskScheduler::RandomDurationBetween(min, max), group, task);
+        return Schedule(TaskScheduler::RandomDurationBetween(min, max), group, std::move(task));
     }
 
     /// Cancels all tasks from within the context.
@@ -628,6 +659,12 @@ public:
     }
 
 private:
+    /// Returns true if the task was repeated already or this context belongs to a previous invocation.
+    bool IsConsumed() const
+    {
+        return !_task || _dispatch != _task->_dispatched || _task->_consumed;
+    }
+
     /// Asserts if the task was consumed already.
     void AssertOnConsumed() const;
 
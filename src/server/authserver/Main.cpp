@@ -24,6 +24,7 @@
 */
 
 #include "AppenderDB.h"
+#include "AuthCryptoWorkerPool.h"
 #include "AuthSocketMgr.h"
 #include "Banner.h"
 #include "Common.h"
@@ -160,6 +161,11 @@ int main(int argc, char** argv)
 
     std::string bindIp = sConfigMgr->GetOption<std::string>("BindIP", "0.0.0.0");
 
+    // Logon proofs are verified on crypto workers, the network thread only handles packets
+    sAuthCryptoWorkerPool->Start(sConfigMgr->GetOption<int32>("CryptoThreads", 2), sConfigMgr->GetOption<int32>("CryptoQueueLimit", 5000));
+
+    std::shared_ptr<void> sAuthCryptoWorkerPoolHandle(nullptr, [](void*) { sAuthCryptoWorkerPool->Stop(); });
+
     if (!sAuthSocketMgr.StartNetwork(*ioContext, bindIp, port))
     {
         LOG_ERROR("server.authserver", "Failed to initialize network");
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuthCryptoWorkerPool.h"
+#include "Log.h"
+
+/*static*/ AuthCryptoWorkerPool* AuthCryptoWorkerPool::instance()
+{
+    static AuthCryptoWorkerPool instance;
+    return &instance;
+}
+
+AuthCryptoWorkerPool::~AuthCryptoWorkerPool()
+{
+    Stop();
+}
+
+void AuthCryptoWorkerPool::Start(uint32 threadCount, uint32 queueLimit)
+{
+    if (IsRunning() || !threadCount)
+        return;
+
+    _queueLimit = queueLimit;
+
+    for (uint32 i = 0; i < threadCount; ++i)
+        _threads.emplace_back(&AuthCryptoWorkerPool::WorkerThread, this);
+
+    LOG_INFO("server.authserver", "Started %u crypto worker threads (queue limit %u).", threadCount, queueLimit);
+}
+
+void AuthCryptoWorkerPool::Stop()
+{
+    if (!IsRunning())
+        return;
+
+    _queue.Cancel();
+
+    for (std::thread& thread : _threads)
+        thread.join();
+
+    _threads.clear();
+}
+
+bool AuthCryptoWorkerPool::Enqueue(Task&& task)
+{
+    if (_queueLimit && ++_pending > _queueLimit)
+    {
+        --_pending;
+        return false;
+    }
+
+    _queue.Push(new Task(std::move(task)));
+    return true;
+}
+
+void AuthCryptoWorkerPool::WorkerThread()
+{
+    for (;;)
+    {
+        Task* task = nullptr;
+        _queue.WaitAndPop(task);
+
+        if (!task)
+            return;
+
+        (*task)();
+        delete task;
+
+        if (_queueLimit)
+            --_pending;
+    }
+}
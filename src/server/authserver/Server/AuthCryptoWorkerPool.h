@@ -0,0 +1,61 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AuthCryptoWorkerPool_h__
+#define AuthCryptoWorkerPool_h__
+
+#include "Define.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+/// Worker threads running the SRP6 logon proof math off the auth network thread
+class AuthCryptoWorkerPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    static AuthCryptoWorkerPool* instance();
+
+    void Start(uint32 threadCount, uint32 queueLimit);
+    void Stop();
+
+    bool IsRunning() const { return !_threads.empty(); }
+
+    /// Queues the task, returns false without queueing it when the pool is saturated
+    bool Enqueue(Task&& task);
+
+private:
+    AuthCryptoWorkerPool() : _pending(0), _queueLimit(0) { }
+    ~AuthCryptoWorkerPool();
+
+    AuthCryptoWorkerPool(AuthCryptoWorkerPool const&) = delete;
+    AuthCryptoWorkerPool& operator=(AuthCryptoWorkerPool const&) = delete;
+
+    void WorkerThread();
+
+    std::vector<std::thread> _threads;
+    ProducerConsumerQueue<Task*> _queue;
+    std::atomic<uint32> _pending;
+    uint32 _queueLimit;
+};
+
+#define sAuthCryptoWorkerPool AuthCryptoWorkerPool::instance()
+
+#endif // AuthCryptoWorkerPool_h__
@@ -18,6 +18,7 @@
 #include "AuthSession.h"
 #include "AES.h"
 #include "AuthCodes.h"
+#include "AuthCryptoWorkerPool.h"
 #include "Config.h"
 #include "CryptoGenerics.h"
 #include "CryptoHash.h"
@@ -471,25 +472,65 @@ bool AuthSession::HandleLogonProof()
         return false;
     }
 
-    // Check if SRP6 results match (password is correct), else send an error
-    if (Optional<SessionKey> K = _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM))
+    // Check auth token, the read buffer is only valid until this handler returns
+    bool tokenSuccess = false;
+    bool sentToken = (logonProof->securityFlags & 0x04);
+    if (sentToken && _totpSecret)
     {
-        _sessionKey = *K;
-        // Check auth token
-        bool tokenSuccess = false;
-        bool sentToken = (logonProof->securityFlags & 0x04);
-        if (sentToken && _totpSecret)
+        uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
+        std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
+        GetReadBuffer().ReadCompleted(sizeof(size) + size);
+
+        uint32 incomingToken = atoi(token.c_str());
+        tokenSuccess = Acore::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
+        memset(_totpSecret->data(), 0, _totpSecret->size());
+    }
+    else if (!sentToken && !_totpSecret)
+        tokenSuccess = true;
+
+    if (!sAuthCryptoWorkerPool->IsRunning())
+    {
+        LogonProofCallback(*logonProof, tokenSuccess, _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM));
+        return true;
+    }
+
+    // Verify the SRP6 proof on a crypto worker, the big number math would stall every other session
+    // on the network thread. The session stays in STATUS_CLOSED until the result is posted back.
+    std::shared_ptr<AuthSession> self = shared_from_this();
+    sAuthLogonProof_C const proof = *logonProof;
+    bool const queued = sAuthCryptoWorkerPool->Enqueue([self, proof, tokenSuccess]()
+    {
+        Optional<SessionKey> K = self->_srp6->VerifyChallengeResponse(proof.A, proof.clientM);
+        self->PostToNetworkThread([self, proof, tokenSuccess, K]()
         {
-            uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
-            std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
-            GetReadBuffer().ReadCompleted(sizeof(size) + size);
+            self->LogonProofCallback(proof, tokenSuccess, K);
+        });
+    });
 
-            uint32 incomingToken = atoi(token.c_str());
-            tokenSuccess = Acore::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
-            memset(_totpSecret->data(), 0, _totpSecret->size());
-        }
-        else if (!sentToken && !_totpSecret)
-            tokenSuccess = true;
+    if (!queued)
+    {
+        ByteBuffer packet;
+        packet << uint8(AUTH_LOGON_PROOF);
+        packet << uint8(WOW_FAIL_DB_BUSY);
+        packet << uint16(0);    // LoginFlags, 1 has account message
+        SendPacket(packet);
+
+        LOG_DEBUG("server.authserver", "'%s:%d' [AuthChallenge] crypto workers are saturated, rejected login of account %s",
+            GetRemoteIpAddress().to_string().c_str(), GetRemotePort(), _accountInfo.Login.c_str());
+    }
+
+    return true;
+}
+
+void AuthSession::LogonProofCallback(sAuthLogonProof_C const& logonProof, bool tokenSuccess, Optional<SessionKey> const& K)
+{
+    if (!IsOpen())
+        return;
+
+    // Check if SRP6 results match (password is correct), else send an error
+    if (K)
+    {
+        _sessionKey = *K;
 
         if (!tokenSuccess)
         {
@@ -498,16 +539,16 @@ bool AuthSession::HandleLogonProof()
             packet << uint8(WOW_FAIL_UNKNOWN_ACCOUNT);
             packet << uint16(0);    // LoginFlags, 1 has account message
             SendPacket(packet);
-            return true;
+            return;
         }
 
-        if (!VerifyVersion(logonProof->A.data(), logonProof->A.size(), logonProof->crc_hash, false))
+        if (!VerifyVersion(logonProof.A.data(), logonProof.A.size(), logonProof.crc_hash, false))
         {
             ByteBuffer packet;
             packet << uint8(AUTH_LOGON_PROOF);
             packet << uint8(WOW_FAIL_VERSION_INVALID);
             SendPacket(packet);
-            return true;
+            return;
         }
 
         LOG_DEBUG("server.authserver", "'%s:%d' User '%s' successfully authenticated", GetRemoteIpAddress().to_string().c_str(), GetRemotePort(), _accountInfo.Login.c_str());
@@ -525,7 +566,7 @@ bool AuthSession::HandleLogonProof()
         LoginDatabase.DirectExecute(stmt);
 
         // Finish SRP6 and send the final result to the client
-        Acore::Crypto::SHA1::Digest M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey);
+        Acore::Crypto::SHA1::Digest M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof.A, logonProof.clientM, _sessionKey);
 
         ByteBuffer packet;
         if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
@@ -615,8 +656,6 @@ bool AuthSession::HandleLogonProof()
             }
         }
     }
-
-    return true;
 }
 
 bool AuthSession::HandleReconnectChallenge()
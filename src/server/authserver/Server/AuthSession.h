@@ -34,6 +34,7 @@ using boost::asio::ip::tcp;
 
 class Field;
 struct AuthHandler;
+struct AUTH_LOGON_PROOF_C;
 
 enum AuthStatus
 {
@@ -88,6 +89,7 @@ private:
     void LogonChallengeCallback(PreparedQueryResult result);
     void ReconnectChallengeCallback(PreparedQueryResult result);
     void RealmListCallback(PreparedQueryResult result);
+    void LogonProofCallback(AUTH_LOGON_PROOF_C const& logonProof, bool tokenSuccess, Optional<SessionKey> const& K);
 
     bool VerifyVersion(uint8 const* a, int32 aLength, Acore::Crypto::SHA1::Digest const& versionProof, bool isReconnect);
 
@@ -110,9 +110,9 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_MAIL_ITEM,
     CHAR_DEL_INVALID_MAIL_ITEM,
     CHAR_SEL_EXPIRED_MAIL,
-    CHAR_SEL_EXPIRED_MAIL_ITEMS,
+    CHAR_DEL_EXPIRED_MAIL_ITEM_INSTANCES,
     CHAR_UPD_MAIL_RETURNED,
-    CHAR_UPD_MAIL_ITEM_RECEIVER,
+    CHAR_UPD_RETURNED_MAIL_ITEMS,
     CHAR_UPD_ITEM_OWNER,
     CHAR_SEL_ITEM_REFUNDS,
     CHAR_SEL_ITEM_BOP_TRADE,
@@ -471,6 +471,8 @@ bool AchievementCriteriaDataSet::Meets(Player const* source, Unit const* target,
 AchievementMgr::AchievementMgr(Player* player)
 {
     m_player = player;
+    m_activeCriteriaDirty = false;
+    m_criteriaUpdateDepth = 0;
 }
 
 AchievementMgr::~AchievementMgr()
@@ -495,6 +497,7 @@ void AchievementMgr::Reset()
 
     m_completedAchievements.clear();
     m_criteriaProgress.clear();
+    InvalidateActiveCriteria();
     DeleteFromDB(m_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -601,6 +604,8 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
 
 void AchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, PreparedQueryResult criteriaResult)
 {
+    InvalidateActiveCriteria();
+
     if (achievementResult)
     {
         do
@@ -792,6 +797,7 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     LOG_DEBUG("achievement", "AchievementMgr::UpdateAchievementCriteria(%u, %u, %u)", type, miscValue1, miscValue2);
 
     AchievementCriteriaEntryList const* achievementCriteriaList = nullptr;
+    uint32 listMiscValue = 0;
 
     switch (type)
     {
@@ -828,6 +834,7 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
             if (miscValue1)
             {
                 achievementCriteriaList = sAchievementMgr->GetSpecialAchievementCriteriaByType(type, miscValue1);
+                listMiscValue = miscValue1;
                 break;
             }
             achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
@@ -836,6 +843,7 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
             if (miscValue2)
             {
                 achievementCriteriaList = sAchievementMgr->GetSpecialAchievementCriteriaByType(type, miscValue2);
+                listMiscValue = miscValue2;
                 break;
             }
             achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
@@ -850,9 +858,11 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
 
     sScriptMgr->OnBeforeCheckCriteria(this, achievementCriteriaList);
 
-    for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
+    // completing an achievement below updates criteria recursively, active lists are only rebuilt by the outermost call
+    ++m_criteriaUpdateDepth;
+
+    for (AchievementCriteriaEntry const* achievementCriteria : GetActiveCriteria(type, listMiscValue, achievementCriteriaList))
     {
-        AchievementCriteriaEntry const* achievementCriteria = (*i);
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
@@ -1749,6 +1759,46 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
                 if (IsCompletedAchievement(*itr))
                     CompletedAchievement(*itr);
     }
+
+    --m_criteriaUpdateDepth;
+}
+
+AchievementMgr::ActiveCriteriaList const& AchievementMgr::GetActiveCriteria(AchievementCriteriaTypes type, uint32 miscValue, AchievementCriteriaEntryList const* criteriaList)
+{
+    // lists handed out earlier may still be iterated by an outer UpdateAchievementCriteria call
+    if (m_activeCriteriaDirty && m_criteriaUpdateDepth <= 1)
+    {
+        m_activeCriteria.clear();
+        m_activeCriteriaDirty = false;
+    }
+
+    auto itr = m_activeCriteria.find((uint64(type) << 32) | miscValue);
+    if (itr != m_activeCriteria.end())
+        return itr->second;
+
+    ActiveCriteriaList& activeCriteria = m_activeCriteria[(uint64(type) << 32) | miscValue];
+    for (AchievementCriteriaEntry const* criteria : *criteriaList)
+        if (!IsRetiredCriteria(criteria))
+            activeCriteria.push_back(criteria);
+
+    return activeCriteria;
+}
+
+// Criteria that IsCompletedCriteria reports as completed no matter the progress, they can never be updated again
+bool AchievementMgr::IsRetiredCriteria(AchievementCriteriaEntry const* criteria) const
+{
+    AchievementEntry const* achievement = sAchievementStore.LookupEntry(criteria->referredAchievement);
+    if (!achievement)
+        return true;
+
+    if (achievement->flags & (ACHIEVEMENT_FLAG_COUNTER | ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
+        return false;
+
+    // criteria shared with other achievements stay completed only while those are completed too
+    if (sAchievementMgr->GetAchievementByReferencedId(achievement->ID))
+        return false;
+
+    return HasAchieved(achievement->ID);
 }
 
 bool AchievementMgr::IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement)
@@ -2202,6 +2252,7 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
     CompletedAchievementData& ca = m_completedAchievements[achievement->ID];
     ca.date = time(nullptr);
     ca.changed = true;
+    InvalidateActiveCriteria();
 
     sScriptMgr->OnAchievementComplete(GetPlayer(), achievement);
 
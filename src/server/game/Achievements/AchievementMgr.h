@@ -26,6 +26,8 @@
 #include <chrono>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
@@ -305,11 +307,22 @@ private:
     bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
     void BuildAllDataPacket(WorldPacket* data) const;
 
+    typedef std::vector<AchievementCriteriaEntry const*> ActiveCriteriaList;
+    ActiveCriteriaList const& GetActiveCriteria(AchievementCriteriaTypes type, uint32 miscValue, AchievementCriteriaEntryList const* criteriaList);
+    [[nodiscard]] bool IsRetiredCriteria(AchievementCriteriaEntry const* criteria) const;
+    void InvalidateActiveCriteria() { m_activeCriteriaDirty = true; }
+
     Player* m_player;
     CriteriaProgressMap m_criteriaProgress;
     CompletedAchievementMap m_completedAchievements;
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
+
+    // criteria that can still progress, per (type, miscValue) list of UpdateAchievementCriteria
+    // built on first use, rebuilt after achievements were completed or reset
+    std::unordered_map<uint64, ActiveCriteriaList> m_activeCriteria;
+    bool m_activeCriteriaDirty;
+    uint32 m_criteriaUpdateDepth;
 };
 
 class AchievementGlobalMgr
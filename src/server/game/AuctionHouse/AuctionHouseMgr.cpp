@@ -17,8 +17,6 @@
 
 #include "AuctionHouseMgr.h"
 #include "AccountMgr.h"
-#include "AsyncAuctionListing.h"
-#include "AvgDiffTracker.h"
 #include "Common.h"
 #include "DBCStores.h"
 #include "DatabaseEnv.h"
@@ -35,7 +33,7 @@
 constexpr auto AH_MINIMUM_DEPOSIT = 100;
 
 // Proof of concept, we should shift the info we're obtaining in here into AuctionEntry probably
-static bool SortAuction(AuctionEntry* left, AuctionEntry* right, AuctionSortOrderVector& sortOrder, Player* player, bool checkMinBidBuyout)
+bool AuctionHouseObject::SortAuction(AuctionEntry const* left, AuctionEntry const* right, AuctionSortOrderVector const& sortOrder, LocaleConstant locale, bool checkMinBidBuyout)
 {
     for (auto thisOrder : sortOrder)
     {
@@ -91,12 +89,6 @@ static bool SortAuction(AuctionEntry* left, AuctionEntry* right, AuctionSortOrde
                     continue;
                 }
 
-                LocaleConstant locale = LOCALE_enUS;
-                if (player && player->GetSession())
-                {
-                    locale = player->GetSession()->GetSessionDbLocaleIndex();
-                }
-
                 if (locale > LOCALE_enUS)
                 {
                     if (ItemLocale const* leftIl = sObjectMgr->GetItemLocale(protoLeft->ItemId))
@@ -632,13 +624,20 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
 {
     ASSERT(auction);
 
-    AuctionsMap[auction->Id] = auction;
+    AuctionEntry*& entry = AuctionsMap[auction->Id];
+    if (entry)
+        UnindexAuction(entry);
+
+    entry = auction;
+    IndexAuction(auction);
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
 bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
 {
     bool wasInMap = !!AuctionsMap.erase(auction->Id);
+    if (wasInMap)
+        UnindexAuction(auction);
 
     sScriptMgr->OnAuctionRemove(this, auction);
 
@@ -649,6 +648,46 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
     return wasInMap;
 }
 
+void AuctionHouseObject::IndexAuction(AuctionEntry* auction)
+{
+    MarkChanged(auction);
+
+    // auctions of unknown items can not match any browse filter
+    if (ItemTemplate const* proto = sObjectMgr->GetItemTemplate(auction->item_template))
+        _auctionsByItemClass[proto->Class][auction->item_template].push_back(auction);
+    else
+        _auctionsOfUnknownItems.push_back(auction);
+}
+
+void AuctionHouseObject::UnindexAuction(AuctionEntry* auction)
+{
+    MarkChanged(auction);
+
+    ItemTemplate const* proto = sObjectMgr->GetItemTemplate(auction->item_template);
+    if (!proto)
+    {
+        _auctionsOfUnknownItems.erase(std::remove(_auctionsOfUnknownItems.begin(), _auctionsOfUnknownItems.end(), auction), _auctionsOfUnknownItems.end());
+        return;
+    }
+
+    auto classItr = _auctionsByItemClass.find(proto->Class);
+    if (classItr == _auctionsByItemClass.end())
+        return;
+
+    auto templateItr = classItr->second.find(auction->item_template);
+    if (templateItr == classItr->second.end())
+        return;
+
+    std::vector<AuctionEntry*>& auctions = templateItr->second;
+    auctions.erase(std::remove(auctions.begin(), auctions.end(), auction), auctions.end());
+    if (auctions.empty())
+    {
+        classItr->second.erase(templateItr);
+        if (classItr->second.empty())
+            _auctionsByItemClass.erase(classItr);
+    }
+}
+
 void AuctionHouseObject::Update()
 {
     time_t checkTime = sWorld->GetGameTime() + 60;
@@ -724,202 +763,6 @@ void AuctionHouseObject::BuildListOwnerItems(WorldPacket& data, Player* player,
     }
 }
 
-bool AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player,
-        std::wstring const& wsearchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax, uint8 usable,
-        uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
-        uint32& count, uint32& totalcount, uint8 /*getAll*/, AuctionSortOrderVector const& sortOrder)
-{
-    uint32 itrcounter = 0;
-
-    std::vector<AuctionEntry*> auctionShortlist;
-
-    // pussywizard: optimization, this is a simplified case
-    if (itemClass == 0xffffffff && itemSubClass == 0xffffffff && inventoryType == 0xffffffff && quality == 0xffffffff && levelmin == 0x00 && levelmax == 0x00 && usable == 0x00 && wsearchedname.empty())
-    {
-        auto itr = GetAuctionsBegin();
-        for (; itr != GetAuctionsEnd(); ++itr)
-        {
-            auctionShortlist.push_back(itr->second);
-        }
-    }
-    else
-    {
-        time_t curTime = sWorld->GetGameTime();
-
-        int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
-        int locdbc_idx = player->GetSession()->GetSessionDbcLocale();
-
-        for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
-        {
-            if (!AsyncAuctionListingMgr::IsAuctionListingAllowed())                                                    // pussywizard: World::Update is waiting for us...
-            {
-                if ((itrcounter++) % 100 == 0) // check condition every 100 iterations
-                {
-                    if (avgDiffTracker.getAverage() >= 30 || getMSTimeDiff(World::GetGameTimeMS(), getMSTime()) >= 10) // pussywizard: stop immediately if diff is high or waiting too long
-                    {
-                        return false;
-                    }
-                }
-            }
-
-            AuctionEntry* Aentry = itr->second;
-            // Skip expired auctions
-            if (Aentry->expire_time < curTime)
-            {
-                continue;
-            }
-
-            Item* item = sAuctionMgr->GetAItem(Aentry->item_guid);
-            if (!item)
-            {
-                continue;
-            }
-
-            ItemTemplate const* proto = item->GetTemplate();
-            if (itemClass != 0xffffffff && proto->Class != itemClass)
-            {
-                continue;
-            }
-
-            if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-            {
-                continue;
-            }
-
-            if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
-            {
-                // xinef: exception, robes are counted as chests
-                if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
-                {
-                    continue;
-                }
-            }
-
-            if (quality != 0xffffffff && proto->Quality < quality)
-            {
-                continue;
-            }
-
-            if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-            {
-                continue;
-            }
-
-            if (usable != 0x00)
-            {
-                if (player->CanUseItem(item) != EQUIP_ERR_OK)
-                {
-                    continue;
-                }
-
-                // xinef: check already learded recipes and pets
-                if (proto->Spells[1].SpellTrigger == ITEM_SPELLTRIGGER_LEARN_SPELL_ID && player->HasSpell(proto->Spells[1].SpellId))
-                {
-                    continue;
-                }
-            }
-
-            // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
-            // No need to do any of this if no search term was entered
-            if (!wsearchedname.empty())
-            {
-                std::string name = proto->Name1;
-                if (name.empty())
-                {
-                    continue;
-                }
-
-                // local name
-                if (loc_idx >= 0)
-                    if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
-                        ObjectMgr::GetLocaleString(il->Name, loc_idx, name);
-
-                // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
-                //  that matches the search but it may not equal item->GetItemRandomPropertyId()
-                //  used in BuildAuctionInfo() which then causes wrong items to be listed
-                int32 propRefID = item->GetItemRandomPropertyId();
-
-                if (propRefID)
-                {
-                    // Append the suffix to the name (ie: of the Monkey) if one exists
-                    // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
-                    // even though the DBC name seems misleading
-                    std::array<char const*, 16> const* suffix = nullptr;
-
-                    if (propRefID < 0)
-                    {
-                        const ItemRandomSuffixEntry* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-item->GetItemRandomPropertyId());
-                        if (itemRandEntry)
-                            suffix = &itemRandEntry->Name;
-                    }
-                    else
-                    {
-                        const ItemRandomPropertiesEntry* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(item->GetItemRandomPropertyId());
-                        if (itemRandEntry)
-                            suffix = &itemRandEntry->Name;
-                    }
-
-                    // dbc local name
-                    if (suffix)
-                    {
-                        // Append the suffix (ie: of the Monkey) to the name using localization
-                        // or default enUS if localization is invalid
-                        name += ' ';
-                        name += (*suffix)[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
-                    }
-                }
-
-                // Perform the search (with or without suffix)
-                if (!Utf8FitTo(name, wsearchedname))
-                {
-                    continue;
-                }
-            }
-
-            auctionShortlist.push_back(Aentry);
-        }
-    }
-
-    // Check if sort enabled, and first sort column is valid, if not don't sort
-    if (sortOrder.size() > 0)
-    {
-        AuctionSortInfo const& sortInfo = *sortOrder.begin();
-        if (sortInfo.sortOrder >= AUCTION_SORT_MINLEVEL && sortInfo.sortOrder < AUCTION_SORT_MAX && sortInfo.sortOrder != AUCTION_SORT_UNK4)
-        {
-            // Partial sort to improve performance a bit, but the last pages will burn
-            if (listfrom + 50 <= auctionShortlist.size())
-            {
-                std::partial_sort(auctionShortlist.begin(), auctionShortlist.begin() + listfrom + 50, auctionShortlist.end(),
-                    std::bind(SortAuction, std::placeholders::_1, std::placeholders::_2, sortOrder, player, sortInfo.sortOrder == AUCTION_SORT_BID));
-            }
-            else
-            {
-                std::sort(auctionShortlist.begin(), auctionShortlist.end(), std::bind(SortAuction, std::placeholders::_1, std::placeholders::_2, sortOrder,
-                    player, sortInfo.sortOrder == AUCTION_SORT_BID));
-            }
-        }
-    }
-
-    for (auto auction : auctionShortlist)
-    {
-        // Add the item if no search term or if entered search term was found
-        if (count < 50 && totalcount >= listfrom)
-        {
-            Item* item = sAuctionMgr->GetAItem(auction->item_guid);
-            if (!item)
-            {
-                continue;
-            }
-
-            ++count;
-            auction->BuildAuctionInfo(data);
-        }
-        ++totalcount;
-    }
-
-    return true;
-}
-
 //this function inserts to WorldPacket auction's data
 bool AuctionEntry::BuildAuctionInfo(WorldPacket& data) const
 {
@@ -25,6 +25,7 @@
 #include "ObjectGuid.h"
 #include "WorldPacket.h"
 #include <unordered_map>
+#include <unordered_set>
 
 class Item;
 class Player;
@@ -138,12 +139,15 @@ public:
     }
 
     typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
+    // secondary index for browse queries: item class -> item template -> auctions of that template
+    typedef std::unordered_map<uint32, std::vector<AuctionEntry*>> AuctionsByItemTemplateMap;
+    typedef std::unordered_map<uint32, AuctionsByItemTemplateMap> AuctionsByItemClassMap;
 
     [[nodiscard]] uint32 Getcount() const { return AuctionsMap.size(); }
 
     AuctionEntryMap::iterator GetAuctionsBegin() { return AuctionsMap.begin(); }
     AuctionEntryMap::iterator GetAuctionsEnd() { return AuctionsMap.end(); }
-    AuctionEntryMap const& GetAuctions() { return AuctionsMap; }
+    [[nodiscard]] AuctionEntryMap const& GetAuctions() const { return AuctionsMap; }
 
     [[nodiscard]] AuctionEntry* GetAuction(uint32 id) const
     {
@@ -159,13 +163,26 @@ public:
 
     void BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
     void BuildListOwnerItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
-    bool BuildListAuctionItems(WorldPacket& data, Player* player,
-                               std::wstring const& searchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax, uint8 usable,
-                               uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
-                               uint32& count, uint32& totalcount, uint8 getAll, AuctionSortOrderVector const& sortOrder);
+
+    [[nodiscard]] AuctionsByItemClassMap const& GetAuctionsByItemClass() const { return _auctionsByItemClass; }
+
+    [[nodiscard]] std::vector<AuctionEntry*> const& GetAuctionsOfUnknownItems() const { return _auctionsOfUnknownItems; }
+
+    // item templates with auction changes visible in listings, the listing snapshot only copies the auctions of those again
+    void MarkChanged(AuctionEntry const* auction) { _changedItemTemplates.insert(auction->item_template); }
+    [[nodiscard]] bool HasChangedItemTemplates() const { return !_changedItemTemplates.empty(); }
+    void TakeChangedItemTemplates(std::unordered_set<uint32>& changed) { changed.clear(); changed.swap(_changedItemTemplates); }
+
+    static bool SortAuction(AuctionEntry const* left, AuctionEntry const* right, AuctionSortOrderVector const& sortOrder, LocaleConstant locale, bool checkMinBidBuyout);
 
 private:
+    void IndexAuction(AuctionEntry* auction);
+    void UnindexAuction(AuctionEntry* auction);
+
     AuctionEntryMap AuctionsMap;
+    AuctionsByItemClassMap _auctionsByItemClass;
+    std::vector<AuctionEntry*> _auctionsOfUnknownItems;    // not in the index, they can not match any browse filter
+    std::unordered_set<uint32> _changedItemTemplates;
 
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator next;
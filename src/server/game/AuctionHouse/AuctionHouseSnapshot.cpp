@@ -0,0 +1,328 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionHouseSnapshot.h"
+#include "DBCStores.h"
+#include "ObjectMgr.h"
+#include "Util.h"
+
+AuctionHouseSnapshot::AuctionHouseSnapshot(AuctionHouseObject const& auctionHouse)
+{
+    for (auto const& [itemClass, auctionsByItemEntry] : auctionHouse.GetAuctionsByItemClass())
+    {
+        std::shared_ptr<ItemClassAuctions> itemClassAuctions = std::make_shared<ItemClassAuctions>();
+        itemClassAuctions->reserve(auctionsByItemEntry.size());
+
+        for (auto const& [itemEntry, auctions] : auctionsByItemEntry)
+            itemClassAuctions->emplace(itemEntry, CopyAuctions(auctions));
+
+        _auctionsByItemClass.emplace(itemClass, std::move(itemClassAuctions));
+    }
+
+    _unindexedAuctions = CopyAuctions(auctionHouse.GetAuctionsOfUnknownItems());
+}
+
+AuctionHouseSnapshot::AuctionHouseSnapshot(AuctionHouseSnapshot const& previous, AuctionHouseObject const& auctionHouse, std::unordered_set<uint32> const& changedItemTemplates) :
+    _auctionsByItemClass(previous._auctionsByItemClass), _unindexedAuctions(previous._unindexedAuctions)
+{
+    // item classes touched by the changes, copied once from the previous snapshot
+    std::unordered_map<uint32, std::shared_ptr<ItemClassAuctions>> changedItemClasses;
+    bool unknownItemsChanged = false;
+
+    for (uint32 itemEntry : changedItemTemplates)
+    {
+        ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemEntry);
+        if (!proto)
+        {
+            unknownItemsChanged = true;
+            continue;
+        }
+
+        std::shared_ptr<ItemClassAuctions>& itemClassAuctions = changedItemClasses[proto->Class];
+        if (!itemClassAuctions)
+        {
+            auto previousItr = _auctionsByItemClass.find(proto->Class);
+            itemClassAuctions = previousItr != _auctionsByItemClass.end() ? std::make_shared<ItemClassAuctions>(*previousItr->second) : std::make_shared<ItemClassAuctions>();
+        }
+
+        std::vector<AuctionEntry*> const* auctions = nullptr;
+        auto classItr = auctionHouse.GetAuctionsByItemClass().find(proto->Class);
+        if (classItr != auctionHouse.GetAuctionsByItemClass().end())
+        {
+            auto entryItr = classItr->second.find(itemEntry);
+            if (entryItr != classItr->second.end())
+                auctions = &entryItr->second;
+        }
+
+        if (auctions)
+            (*itemClassAuctions)[itemEntry] = CopyAuctions(*auctions);
+        else
+            itemClassAuctions->erase(itemEntry);
+    }
+
+    for (auto& [itemClass, itemClassAuctions] : changedItemClasses)
+    {
+        if (itemClassAuctions->empty())
+            _auctionsByItemClass.erase(itemClass);
+        else
+            _auctionsByItemClass[itemClass] = std::move(itemClassAuctions);
+    }
+
+    if (unknownItemsChanged)
+        _unindexedAuctions = CopyAuctions(auctionHouse.GetAuctionsOfUnknownItems());
+}
+
+AuctionHouseSnapshot::EntriesPtr AuctionHouseSnapshot::CopyAuctions(std::vector<AuctionEntry*> const& auctions)
+{
+    std::shared_ptr<std::vector<Entry>> entries = std::make_shared<std::vector<Entry>>();
+    entries->reserve(auctions.size());
+
+    for (AuctionEntry const* auction : auctions)
+        if (Item* item = sAuctionMgr->GetAItem(auction->item_guid))
+            FillEntry(entries->emplace_back(), *auction, *item);
+
+    return entries;
+}
+
+void AuctionHouseSnapshot::FillEntry(Entry& entry, AuctionEntry const& auction, Item const& item)
+{
+    entry.Auction = auction;
+    for (uint8 i = 0; i < MAX_INSPECTED_ENCHANTMENT_SLOT; ++i)
+    {
+        entry.Enchantments[i][0] = item.GetEnchantmentId(EnchantmentSlot(i));
+        entry.Enchantments[i][1] = item.GetEnchantmentDuration(EnchantmentSlot(i));
+        entry.Enchantments[i][2] = item.GetEnchantmentCharges(EnchantmentSlot(i));
+    }
+
+    entry.RandomPropertyId = item.GetItemRandomPropertyId();
+    entry.SuffixFactor = item.GetItemSuffixFactor();
+    entry.Count = item.GetCount();
+    entry.SpellCharges = item.GetSpellCharges();
+
+    if (item.IsSoulBound() && !item.IsBoundAccountWide())
+    {
+        entry.BoundTo = item.GetOwnerGUID();
+        if (item.HasFlag(ITEM_FIELD_FLAGS, ITEM_FIELD_FLAG_BOP_TRADEABLE))
+            entry.TradeableWith.assign(item.GetSoulboundTradeableLooters().begin(), item.GetSoulboundTradeableLooters().end());
+    }
+}
+
+bool AuctionHouseSnapshot::Entry::IsBoundNotWith(ObjectGuid playerGuid) const
+{
+    return BoundTo && BoundTo != playerGuid && std::find(TradeableWith.begin(), TradeableWith.end(), playerGuid) == TradeableWith.end();
+}
+
+bool AuctionHouseSnapshot::IsUnfiltered(AuctionListingQuery const& query)
+{
+    return query.ItemClass == 0xffffffff && query.ItemSubClass == 0xffffffff && query.InventoryType == 0xffffffff && query.Quality == 0xffffffff
+        && query.LevelMin == 0x00 && query.LevelMax == 0x00 && !query.Usable && query.SearchedName.empty();
+}
+
+void AuctionHouseSnapshot::Entry::BuildAuctionInfo(WorldPacket& data, time_t now) const
+{
+    data << uint32(Auction.Id);
+    data << uint32(Auction.item_template);
+
+    for (uint8 i = 0; i < MAX_INSPECTED_ENCHANTMENT_SLOT; ++i)
+    {
+        data << uint32(Enchantments[i][0]);
+        data << uint32(Enchantments[i][1]);
+        data << uint32(Enchantments[i][2]);
+    }
+
+    data << int32(RandomPropertyId);                                // Random item property id
+    data << uint32(SuffixFactor);                                   // SuffixFactor
+    data << uint32(Count);                                          // item->count
+    data << uint32(SpellCharges);                                   // item->charge FFFFFFF
+    data << uint32(0);                                              // Unknown
+    data << Auction.owner;                                          // Auction->owner
+    data << uint32(Auction.startbid);                               // Auction->startbid (not sure if useful)
+    data << uint32(Auction.bid ? Auction.GetAuctionOutBid() : 0);   // Minimal outbid
+    data << uint32(Auction.buyout);                                 // Auction->buyout
+    data << uint32((Auction.expire_time - now) * IN_MILLISECONDS);  // time left
+    data << Auction.bidder;                                         // auction->bidder current
+    data << uint32(Auction.bid);                                    // current bid
+}
+
+void AuctionHouseSnapshot::Search(AuctionListingQuery const& query, std::vector<Entry const*>& result) const
+{
+    // pussywizard: optimization, this is a simplified case
+    if (IsUnfiltered(query))
+    {
+        for (auto const& itemClassAuctions : _auctionsByItemClass)
+            for (auto const& itemEntryAuctions : *itemClassAuctions.second)
+                for (Entry const& entry : *itemEntryAuctions.second)
+                    result.push_back(&entry);
+
+        for (Entry const& entry : *_unindexedAuctions)
+            result.push_back(&entry);
+
+        return;
+    }
+
+    time_t curTime = sWorld->GetGameTime();
+
+    // filters on item template properties are checked once per distinct item, not once per auction
+    auto searchItemClass = [&](ItemClassAuctions const& itemClassAuctions)
+    {
+        for (auto const& [itemEntry, auctions] : itemClassAuctions)
+        {
+            ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itemEntry);
+            if (query.ItemSubClass != 0xffffffff && proto->SubClass != query.ItemSubClass)
+                continue;
+
+            if (query.InventoryType != 0xffffffff && proto->InventoryType != query.InventoryType)
+            {
+                // xinef: exception, robes are counted as chests
+                if (query.InventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+                    continue;
+            }
+
+            if (query.Quality != 0xffffffff && proto->Quality < query.Quality)
+                continue;
+
+            if (query.LevelMin != 0x00 && (proto->RequiredLevel < query.LevelMin || (query.LevelMax != 0x00 && proto->RequiredLevel > query.LevelMax)))
+                continue;
+
+            // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
+            // No need to do any of this if no search term was entered
+            std::string name;
+            bool nameMatches = query.SearchedName.empty();
+            if (!nameMatches)
+            {
+                name = proto->Name1;
+                if (name.empty())
+                    continue;
+
+                // local name
+                if (query.DbLocale > LOCALE_enUS)
+                    if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+                        ObjectMgr::GetLocaleString(il->Name, query.DbLocale, name);
+
+                // the name with a suffix contains the plain name, so a match here covers every auction of the item.
+                // Otherwise only a random suffix can still make an auction match
+                nameMatches = Utf8FitTo(name, query.SearchedName);
+                if (!nameMatches && !proto->RandomProperty && !proto->RandomSuffix)
+                    continue;
+            }
+
+            for (Entry const& entry : *auctions)
+            {
+                // Skip expired auctions
+                if (entry.Auction.expire_time < curTime)
+                    continue;
+
+                if (!nameMatches)
+                {
+                    // Append the suffix to the name (ie: of the Monkey) if one exists
+                    // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
+                    // even though the DBC name seems misleading
+                    std::array<char const*, 16> const* suffix = nullptr;
+
+                    if (entry.RandomPropertyId < 0)
+                    {
+                        if (ItemRandomSuffixEntry const* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-entry.RandomPropertyId))
+                            suffix = &itemRandEntry->Name;
+                    }
+                    else if (entry.RandomPropertyId > 0)
+                    {
+                        if (ItemRandomPropertiesEntry const* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(entry.RandomPropertyId))
+                            suffix = &itemRandEntry->Name;
+                    }
+
+                    if (!suffix)
+                        continue;
+
+                    // Append the suffix (ie: of the Monkey) to the name using localization
+                    // or default enUS if localization is invalid
+                    std::string suffixedName = name;
+                    suffixedName += ' ';
+                    suffixedName += (*suffix)[query.DbcLocale >= 0 ? query.DbcLocale : LOCALE_enUS];
+
+                    if (!Utf8FitTo(suffixedName, query.SearchedName))
+                        continue;
+                }
+
+                result.push_back(&entry);
+            }
+        }
+    };
+
+    if (query.ItemClass != 0xffffffff)
+    {
+        auto itr = _auctionsByItemClass.find(query.ItemClass);
+        if (itr != _auctionsByItemClass.end())
+            searchItemClass(*itr->second);
+    }
+    else
+    {
+        for (auto const& itemClassAuctions : _auctionsByItemClass)
+            searchItemClass(*itemClassAuctions.second);
+    }
+}
+
+void AuctionHouseSnapshot::FilterUsable(std::vector<Entry const*>& entries, ObjectGuid playerGuid, UsableCheck const& check)
+{
+    std::unordered_map<uint32, bool> usableItems;
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [&](Entry const* entry)
+    {
+        if (entry->IsBoundNotWith(playerGuid))
+            return true;
+
+        auto itr = usableItems.find(entry->Auction.item_template);
+        if (itr == usableItems.end())
+            itr = usableItems.emplace(entry->Auction.item_template, check(sObjectMgr->GetItemTemplate(entry->Auction.item_template))).first;
+
+        return !itr->second;
+    }), entries.end());
+}
+
+void AuctionHouseSnapshot::BuildListAuctionItems(WorldPacket& data, AuctionListingQuery const& query, std::vector<Entry const*>& entries, uint32& count, uint32& totalcount)
+{
+    // the search has no meaningful order, default to auction id order
+    auto sortById = [](Entry const* left, Entry const* right) { return left->Auction.Id < right->Auction.Id; };
+
+    // Check if sort enabled, and first sort column is valid, if not don't sort
+    AuctionSortInfo const* sortInfo = query.SortOrder.empty() ? nullptr : &query.SortOrder.front();
+    if (sortInfo && sortInfo->sortOrder >= AUCTION_SORT_MINLEVEL && sortInfo->sortOrder < AUCTION_SORT_MAX && sortInfo->sortOrder != AUCTION_SORT_UNK4)
+    {
+        auto sortAuction = [&query, checkMinBidBuyout = sortInfo->sortOrder == AUCTION_SORT_BID](Entry const* left, Entry const* right)
+        {
+            return AuctionHouseObject::SortAuction(&left->Auction, &right->Auction, query.SortOrder, query.DbLocale, checkMinBidBuyout);
+        };
+
+        // Partial sort to improve performance a bit, but the last pages will burn
+        if (query.ListFrom + 50 <= entries.size())
+            std::partial_sort(entries.begin(), entries.begin() + query.ListFrom + 50, entries.end(), sortAuction);
+        else
+            std::sort(entries.begin(), entries.end(), sortAuction);
+    }
+    else
+        std::sort(entries.begin(), entries.end(), sortById);
+
+    time_t now = time(nullptr);
+    for (Entry const* entry : entries)
+    {
+        if (count < 50 && totalcount >= query.ListFrom)
+        {
+            ++count;
+            entry->BuildAuctionInfo(data, now);
+        }
+
+        ++totalcount;
+    }
+}
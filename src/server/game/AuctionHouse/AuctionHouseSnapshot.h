@@ -0,0 +1,99 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _AUCTION_HOUSE_SNAPSHOT_H
+#define _AUCTION_HOUSE_SNAPSHOT_H
+
+#include "AuctionHouseMgr.h"
+#include "Item.h"
+#include <functional>
+#include <memory>
+#include <unordered_set>
+
+struct AuctionListingQuery
+{
+    std::wstring SearchedName;                              // lower case
+    uint32 ListFrom;
+    uint8 LevelMin;
+    uint8 LevelMax;
+    uint32 InventoryType;
+    uint32 ItemClass;
+    uint32 ItemSubClass;
+    uint32 Quality;
+    bool Usable;
+    AuctionSortOrderVector SortOrder;
+    LocaleConstant DbLocale;                                // locale of item names
+    LocaleConstant DbcLocale;                               // locale of random suffix names
+};
+
+/*
+ * Read-only copy of the listable state of one auction house, used by the auction listing thread.
+ * It is built by the world thread from the live AuctionHouseObject inside its auction section, and
+ * is never modified afterwards, so searches run on it without any lock.
+ * The auctions of each item template are shared with later snapshots until one of them changes,
+ * so a new snapshot only copies the auctions of the item templates changed since the previous one.
+ */
+class AuctionHouseSnapshot
+{
+public:
+    struct Entry
+    {
+        AuctionEntry Auction;
+        uint32 Enchantments[MAX_INSPECTED_ENCHANTMENT_SLOT][3];
+        int32 RandomPropertyId;
+        uint32 SuffixFactor;
+        uint32 Count;
+        uint32 SpellCharges;
+        ObjectGuid BoundTo;                                 // owner of a soulbound item, empty if it is not bound
+        std::vector<ObjectGuid> TradeableWith;              // players a soulbound item may still be traded to
+
+        void BuildAuctionInfo(WorldPacket& data, time_t now) const;
+        // same as Item::IsBindedNotWith
+        [[nodiscard]] bool IsBoundNotWith(ObjectGuid playerGuid) const;
+    };
+
+    typedef std::function<bool(ItemTemplate const*)> UsableCheck;
+
+    // copies every auction, for the first snapshot of an auction house
+    explicit AuctionHouseSnapshot(AuctionHouseObject const& auctionHouse);
+    // shares everything with the previous snapshot except the auctions of changedItemTemplates
+    AuctionHouseSnapshot(AuctionHouseSnapshot const& previous, AuctionHouseObject const& auctionHouse, std::unordered_set<uint32> const& changedItemTemplates);
+
+    // appends all entries matching the query filters, except the per player "usable" filter.
+    // Like the live search, a query without any filter lists every auction, expired ones included
+    void Search(AuctionListingQuery const& query, std::vector<Entry const*>& result) const;
+    // drops the entries bound to another player and those the player can not use, check is called once per distinct item
+    static void FilterUsable(std::vector<Entry const*>& entries, ObjectGuid playerGuid, UsableCheck const& check);
+    // sorts the search result and writes the requested page, same layout as SMSG_AUCTION_LIST_RESULT
+    static void BuildListAuctionItems(WorldPacket& data, AuctionListingQuery const& query, std::vector<Entry const*>& entries, uint32& count, uint32& totalcount);
+
+private:
+    typedef std::shared_ptr<std::vector<Entry> const> EntriesPtr;
+    typedef std::unordered_map<uint32 /*item template*/, EntriesPtr> ItemClassAuctions;
+    typedef std::shared_ptr<ItemClassAuctions const> ItemClassAuctionsPtr;
+
+    static EntriesPtr CopyAuctions(std::vector<AuctionEntry*> const& auctions);
+    static void FillEntry(Entry& entry, AuctionEntry const& auction, Item const& item);
+    [[nodiscard]] static bool IsUnfiltered(AuctionListingQuery const& query);
+
+    std::unordered_map<uint32 /*item class*/, ItemClassAuctionsPtr> _auctionsByItemClass;
+    EntriesPtr _unindexedAuctions;                          // unknown item templates, only listed by the unfiltered search
+};
+
+typedef std::shared_ptr<AuctionHouseSnapshot const> AuctionHouseSnapshotPtr;
+
+#endif
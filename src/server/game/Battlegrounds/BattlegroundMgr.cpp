@@ -39,6 +39,7 @@
 #include "Map.h"
 #include "MapInstanced.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Player.h"
@@ -109,6 +110,8 @@ void BattlegroundMgr::Update(uint32 diff)
     // update using scheduled tasks (used only for rated arenas, initial opponent search works differently than periodic queue update)
     if (!m_ArenaQueueUpdateScheduler.empty())
     {
+        METRIC_TIMER("battleground_queue_update_time", METRIC_TAG("type", "Scheduled rated arena"));
+
         std::vector<uint64> scheduled;
         std::swap(scheduled, m_ArenaQueueUpdateScheduler);
         for (uint8 i = 0; i < scheduled.size(); i++)
@@ -123,6 +126,8 @@ void BattlegroundMgr::Update(uint32 diff)
     // periodic queue update
     if (m_NextPeriodicQueueUpdateTime < diff)
     {
+        METRIC_TIMER("battleground_queue_update_time", METRIC_TAG("type", "Periodic"));
+
         m_NextPeriodicQueueUpdateTime = 5 * IN_MILLISECONDS;
 
         // for rated arenas
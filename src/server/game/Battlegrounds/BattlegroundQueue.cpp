@@ -25,6 +25,7 @@
 #include "Group.h"
 #include "Language.h"
 #include "Log.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -64,6 +65,9 @@ BattlegroundQueue::~BattlegroundQueue()
             j.clear();
         }
     }
+
+    for (auto& index : m_RatedArenaIndex)
+        index.clear();
 }
 
 /*********************************************************/
@@ -190,6 +194,9 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* grp, PvPDiffi
     //add GroupInfo to m_QueuedGroups
     m_QueuedGroups[bracketId][index].push_back(ginfo);
 
+    if (isRated)
+        AddToRatedArenaIndex(ginfo);
+
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
 
@@ -325,6 +332,9 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool sentToBg, uint32 play
     // remove group queue info no players left
     if (groupInfo->Players.empty())
     {
+        if (groupInfo->IsRated)
+            RemoveFromRatedArenaIndex(groupInfo);
+
         m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
         delete groupInfo;
         return;
@@ -678,6 +688,100 @@ void BattlegroundQueue::UpdateEvents(uint32 diff)
 struct BgEmptinessComp { bool operator()(Battleground* const& bg1, Battleground* const& bg2) const { return ((float)bg1->GetMaxFreeSlots() / (float)bg1->GetMaxPlayersPerTeam()) > ((float)bg2->GetMaxFreeSlots() / (float)bg2->GetMaxPlayersPerTeam()); } };
 typedef std::set<Battleground*, BgEmptinessComp> BattlegroundNeedSet;
 
+// matchmaker ratings above this value are treated as equal when looking for opponents
+static constexpr uint32 ARENA_MAX_COUNTED_MMR = 2500;
+
+void BattlegroundQueue::AddToRatedArenaIndex(GroupQueueInfo* ginfo)
+{
+    m_RatedArenaIndex[ginfo->_bracketId].emplace(std::min(ginfo->ArenaMatchmakerRating, ARENA_MAX_COUNTED_MMR), ginfo);
+}
+
+void BattlegroundQueue::RemoveFromRatedArenaIndex(GroupQueueInfo* ginfo)
+{
+    RatedArenaIndex& index = m_RatedArenaIndex[ginfo->_bracketId];
+    auto bounds = index.equal_range(std::min(ginfo->ArenaMatchmakerRating, ARENA_MAX_COUNTED_MMR));
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+    {
+        if (itr->second == ginfo)
+        {
+            index.erase(itr);
+            return;
+        }
+    }
+}
+
+/*
+    Looks for the opponent of a rated arena team. Candidates are visited outwards from the team's own rating,
+    so in order of growing rating difference, and the first one satisfying any of these rules is taken:
+      - the team waited 20 minutes: closest rating, regardless the difference
+      - both teams have 2000+ rating and one of them waited 2 rating discard periods: closest 2000+ team
+      - closest team within the allowed difference, which grows with the shorter wait time of both teams
+    The walk ends once no further candidate can satisfy any rule, so only teams in the rating window are visited.
+*/
+GroupQueueInfo* BattlegroundQueue::FindRatedArenaOpponent(GroupQueueInfo* ginfo, uint32 maxDefaultRatingDifference, uint32& mmrDifference) const
+{
+    const uint32 currMSTime = World::GetGameTimeMS();
+    const uint32 discardTime = sBattlegroundMgr->GetRatingDiscardTimer();
+    const uint32 waitTime = currMSTime - ginfo->JoinTime;
+    const uint32 MMR1 = std::min(ginfo->ArenaMatchmakerRating, ARENA_MAX_COUNTED_MMR);
+    const bool anyDifference = waitTime >= 20 * MINUTE * IN_MILLISECONDS;
+    // the shorter wait time of both teams is never above our own, which bounds the allowed difference of every pair
+    const uint32 maxPossibleDiff = maxDefaultRatingDifference + 150 + waitTime / 600;
+
+    RatedArenaIndex const& index = m_RatedArenaIndex[ginfo->_bracketId];
+    RatedArenaIndex::const_iterator up = index.lower_bound(MMR1);
+    RatedArenaIndex::const_reverse_iterator down(up);
+
+    while (true)
+    {
+        bool upValid = up != index.end();
+        bool downValid = down != index.rend();
+
+        // a side is done once its candidates are out of the window and can not be paired as 2000+ vs 2000+ either
+        if (upValid && !anyDifference && up->first - MMR1 > maxPossibleDiff && MMR1 < 2000)
+            upValid = false;
+        if (downValid && !anyDifference && MMR1 - down->first > maxPossibleDiff && (MMR1 < 2000 || down->first < 2000))
+            downValid = false;
+
+        if (!upValid && !downValid)
+            break;
+
+        GroupQueueInfo* candidate;
+        uint32 MMR2;
+        if (upValid && (!downValid || up->first - MMR1 <= MMR1 - down->first))
+        {
+            MMR2 = up->first;
+            candidate = (up++)->second;
+        }
+        else
+        {
+            MMR2 = down->first;
+            candidate = (down++)->second;
+        }
+
+        if (candidate->ArenaTeamId == ginfo->ArenaTeamId || candidate->IsInvitedToBGInstanceGUID)
+            continue;
+
+        const uint32 MMRDiff = (MMR2 >= MMR1 ? MMR2 - MMR1 : MMR1 - MMR2);
+        const uint32 candidateWaitTime = currMSTime - candidate->JoinTime;
+        const uint32 shorterWaitTime = std::min(waitTime, candidateWaitTime);
+        const uint32 longerWaitTime = std::max(waitTime, candidateWaitTime);
+
+        uint32 maxAllowedDiff = maxDefaultRatingDifference;
+        if (longerWaitTime >= discardTime)
+            maxAllowedDiff += 150;
+        maxAllowedDiff += shorterWaitTime / 600; // increased by 100 for each minute
+
+        if (anyDifference || MMRDiff <= maxAllowedDiff || (MMR1 >= 2000 && MMR2 >= 2000 && longerWaitTime >= 2 * discardTime))
+        {
+            mmrDifference = MMRDiff;
+            return candidate;
+        }
+    }
+
+    return nullptr;
+}
+
 void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundBracketId bracket_id, bool isRated, uint32 arenaRatedTeamId)
 {
     // if no players in queue - do nothing
@@ -798,9 +902,7 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundBracket
         // pussywizard: everything inside this section is mine, do NOT destroy!
 
         const uint32 currMSTime = World::GetGameTimeMS();
-        const uint32 discardTime = sBattlegroundMgr->GetRatingDiscardTimer();
         const uint32 maxDefaultRatingDifference = (MaxPlayersPerTeam > 2 ? 300 : 200);
-        const uint32 maxCountedMMR = 2500;
 
         // we need to find 2 teams which will play next game
         GroupsQueueType::iterator itr_teams[BG_TEAMS_COUNT];
@@ -820,136 +922,65 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundBracket
                 if ((*itr)->IsInvitedToBGInstanceGUID)
                     continue;
 
-                uint32 MMR1 = std::min((*itr)->ArenaMatchmakerRating, maxCountedMMR);
-
-                GroupsQueueType::iterator oponentItr;
-                uint8 oponentQueue = BG_QUEUE_MAX;
-                uint32 minOponentMMRDiff = 0xffffffff;
-                uint8 oponentValid = 0;
+                uint32 mmrDifference = 0;
+                GroupQueueInfo* oponent = FindRatedArenaOpponent(*itr, maxDefaultRatingDifference, mmrDifference);
 
-                bool reverse2 = urand(0, 1) != 0;
-                for (uint8 jj = BG_QUEUE_PREMADE_ALLIANCE; jj <= BG_QUEUE_PREMADE_HORDE; jj++)
+                if (oponent)
                 {
-                    uint8 j = reverse2 ? (BG_QUEUE_PREMADE_HORDE - jj) : jj;
-                    bool brk = false;
-                    for (auto itr2 = m_QueuedGroups[bracket_id][j].begin(); itr2 != m_QueuedGroups[bracket_id][j].end(); ++itr2)
+                    GroupsQueueType& oponentQueue = m_QueuedGroups[bracket_id][oponent->_groupType];
+                    itr_teams[i] = itr;
+                    itr_teams[i == 0 ? 1 : 0] = std::find(oponentQueue.begin(), oponentQueue.end(), oponent);
+
                     {
-                        if ((*itr)->ArenaTeamId == (*itr2)->ArenaTeamId)
-                            continue;
-                        if ((*itr2)->IsInvitedToBGInstanceGUID)
-                            continue;
-                        uint32 MMR2 = std::min((*itr2)->ArenaMatchmakerRating, maxCountedMMR);
-                        uint32 MMRDiff = (MMR2 >= MMR1 ? MMR2 - MMR1 : MMR1 - MMR2);
-
-                        uint32 maxAllowedDiff = maxDefaultRatingDifference;
-                        uint32 shorterWaitTime, longerWaitTime;
-                        if (currMSTime - (*itr)->JoinTime <= currMSTime - (*itr2)->JoinTime)
-                        {
-                            shorterWaitTime = currMSTime - (*itr)->JoinTime;
-                            longerWaitTime = currMSTime - (*itr2)->JoinTime;
-                        }
-                        else
-                        {
-                            shorterWaitTime = currMSTime - (*itr2)->JoinTime;
-                            longerWaitTime = currMSTime - (*itr)->JoinTime;
-                        }
-                        if (longerWaitTime >= discardTime)
-                            maxAllowedDiff += 150;
-                        maxAllowedDiff += shorterWaitTime / 600; // increased by 100 for each minute
+                        GroupQueueInfo* aTeam = *itr_teams[TEAM_ALLIANCE];
+                        GroupQueueInfo* hTeam = *itr_teams[TEAM_HORDE];
+                        Battleground* arena = sBattlegroundMgr->CreateNewBattleground(m_bgTypeId, bracketEntry->minLevel, bracketEntry->maxLevel, m_arenaType, true);
+                        if (!arena)
+                            return;
 
-                        // now check if this team is more appropriate than previous ones:
+                        aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
+                        hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
+                        aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
+                        hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
 
-                        if (currMSTime - (*itr)->JoinTime >= 20 * MINUTE * IN_MILLISECONDS && (oponentValid < 3 || MMRDiff < minOponentMMRDiff)) // after 20 minutes of waiting, pair with closest mmr, regardless the difference
+                        // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
+                        if (aTeam->teamId != TEAM_ALLIANCE)
                         {
-                            oponentValid = 3;
-                            minOponentMMRDiff = MMRDiff;
-                            oponentItr = itr2;
-                            oponentQueue = j;
+                            aTeam->_groupType = BG_QUEUE_PREMADE_ALLIANCE;
+                            m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
+                            m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
+                            increaseItr = false;
+                            itr = m_QueuedGroups[bracket_id][i].begin();
                         }
-                        else if (MMR1 >= 2000 && MMR2 >= 2000 && longerWaitTime >= 2 * discardTime && (oponentValid < 2 || MMRDiff < minOponentMMRDiff)) // after 6 minutes of waiting, pair any 2000+ vs 2000+
+                        if (hTeam->teamId != TEAM_HORDE)
                         {
-                            oponentValid = 2;
-                            minOponentMMRDiff = MMRDiff;
-                            oponentItr = itr2;
-                            oponentQueue = j;
-                        }
-                        else if (oponentValid < 2 && MMRDiff < minOponentMMRDiff)
-                        {
-                            if (!oponentValid)
-                            {
-                                minOponentMMRDiff = MMRDiff;
-                                oponentItr = itr2;
-                                oponentQueue = j;
-                                if (MMRDiff <= maxAllowedDiff)
-                                    oponentValid = 1;
-                            }
-                            if ((MMR1 < 1800 || MMR2 < 1800) && MaxPlayersPerTeam == 2 && MMRDiff <= maxDefaultRatingDifference) // in 2v2 below 1800 mmr - priority for default allowed difference
-                            {
-                                minOponentMMRDiff = MMRDiff;
-                                oponentItr = itr2;
-                                oponentQueue = j;
-                                brk = true;
-                                break;
-                            }
+                            hTeam->_groupType = BG_QUEUE_PREMADE_HORDE;
+                            m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
+                            m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
+                            increaseItr = false;
+                            itr = m_QueuedGroups[bracket_id][i].begin();
                         }
-                    }
-                    if (brk)
-                        break;
-                }
-
-                if (oponentQueue != BG_QUEUE_MAX)
-                {
-                    if (oponentValid)
-                    {
-                        itr_teams[i] = itr;
-                        itr_teams[i == 0 ? 1 : 0] = oponentItr;
-
-                        {
-                            GroupQueueInfo* aTeam = *itr_teams[TEAM_ALLIANCE];
-                            GroupQueueInfo* hTeam = *itr_teams[TEAM_HORDE];
-                            Battleground* arena = sBattlegroundMgr->CreateNewBattleground(m_bgTypeId, bracketEntry->minLevel, bracketEntry->maxLevel, m_arenaType, true);
-                            if (!arena)
-                                return;
-
-                            aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
-                            hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
-                            aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
-                            hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
-
-                            // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
-                            if (aTeam->teamId != TEAM_ALLIANCE)
-                            {
-                                aTeam->_groupType = BG_QUEUE_PREMADE_ALLIANCE;
-                                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
-                                increaseItr = false;
-                                itr = m_QueuedGroups[bracket_id][i].begin();
-                            }
-                            if (hTeam->teamId != TEAM_HORDE)
-                            {
-                                hTeam->_groupType = BG_QUEUE_PREMADE_HORDE;
-                                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
-                                increaseItr = false;
-                                itr = m_QueuedGroups[bracket_id][i].begin();
-                            }
 
-                            arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
-                            arena->SetArenaMatchmakerRating(TEAM_HORDE, hTeam->ArenaMatchmakerRating);
-                            BattlegroundMgr::InviteGroupToBG(aTeam, arena, TEAM_ALLIANCE);
-                            BattlegroundMgr::InviteGroupToBG(hTeam, arena, TEAM_HORDE);
+                        arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
+                        arena->SetArenaMatchmakerRating(TEAM_HORDE, hTeam->ArenaMatchmakerRating);
+                        BattlegroundMgr::InviteGroupToBG(aTeam, arena, TEAM_ALLIANCE);
+                        BattlegroundMgr::InviteGroupToBG(hTeam, arena, TEAM_HORDE);
 
-                            arena->StartBattleground();
-                        }
+                        arena->StartBattleground();
 
-                        if (arenaRatedTeamId)
-                            return;
-                        else
-                            continue;
+                        METRIC_VALUE("arena_match_mmr_difference", uint64(mmrDifference),
+                            METRIC_TAG("arena_type", std::to_string(m_arenaType)));
+                        METRIC_VALUE("arena_match_wait_time", uint64(currMSTime - std::min(aTeam->JoinTime, hTeam->JoinTime)),
+                            METRIC_TAG("arena_type", std::to_string(m_arenaType)));
                     }
-                    else if (arenaRatedTeamId)
+
+                    if (arenaRatedTeamId)
                         return;
+                    else
+                        continue;
                 }
+                else if (arenaRatedTeamId)
+                    return;
             }
         }
     }
@@ -24,6 +24,7 @@
 #include "EventProcessor.h"
 #include <array>
 #include <deque>
+#include <map>
 
 #define COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME 10
 
@@ -109,6 +110,10 @@ public:
     */
     GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_MAX];
 
+    // rated arena teams of both factions ordered by capped matchmaker rating, teams with equal rating stay in join order
+    typedef std::multimap<uint32, GroupQueueInfo*> RatedArenaIndex;
+    RatedArenaIndex m_RatedArenaIndex[MAX_BATTLEGROUND_BRACKETS];
+
     // class to select and invite groups to bg
     class SelectionPool
     {
@@ -134,6 +139,10 @@ public:
     [[nodiscard]] int32 GetQueueAnnouncementTimer(uint32 bracketId) const;
 
 private:
+    void AddToRatedArenaIndex(GroupQueueInfo* ginfo);
+    void RemoveFromRatedArenaIndex(GroupQueueInfo* ginfo);
+    GroupQueueInfo* FindRatedArenaOpponent(GroupQueueInfo* ginfo, uint32 maxDefaultRatingDifference, uint32& mmrDifference) const;
+
     BattlegroundTypeId m_bgTypeId;
     ArenaType m_arenaType;
     uint32 m_WaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
@@ -23,12 +23,202 @@
 #include "Timer.h"
 #include "World.h"
 #include "WorldPacket.h"
-#include <unordered_map>
+#include <deque>
+#include <functional>
+#include <limits>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    /**
+    * @brief Open addressed index from a 32 bit key to a slot of the cache store.
+    *
+    * Keys do not have to be unique, Find() confirms candidates through the match callback.
+    * Buckets live in a single vector, so indexing millions of characters costs no per entry allocation.
+    */
+    class CacheSlotIndex
+    {
+        static constexpr uint32 EMPTY_SLOT = std::numeric_limits<uint32>::max();
+        static constexpr uint32 REMOVED_SLOT = EMPTY_SLOT - 1;
+        static constexpr uint32 MIN_CAPACITY = 16;
+
+        struct Bucket
+        {
+            uint32 Key;
+            uint32 Slot;
+        };
+
+    public:
+        static constexpr uint32 NOT_FOUND = EMPTY_SLOT;
+
+        CacheSlotIndex() : _size(0), _used(0), _shift(64) { }
+
+        template<class Match>
+        uint32 Find(uint32 key, Match const& match) const
+        {
+            if (_buckets.empty())
+            {
+                return NOT_FOUND;
+            }
+
+            for (std::size_t i = Position(key); ; i = (i + 1) & (_buckets.size() - 1))
+            {
+                Bucket const& bucket = _buckets[i];
+                if (bucket.Slot == EMPTY_SLOT)
+                {
+                    return NOT_FOUND;
+                }
+
+                if (bucket.Slot != REMOVED_SLOT && bucket.Key == key && match(bucket.Slot))
+                {
+                    return bucket.Slot;
+                }
+            }
+        }
+
+        void Insert(uint32 key, uint32 slot)
+        {
+            // keep at most half of the buckets in use, removed ones included, so probe chains stay short
+            if ((_used + 1) * 2 > _buckets.size())
+            {
+                Rehash(std::max<std::size_t>(MIN_CAPACITY, (_size + 1) * 4));
+            }
+
+            for (std::size_t i = Position(key); ; i = (i + 1) & (_buckets.size() - 1))
+            {
+                Bucket& bucket = _buckets[i];
+                if (bucket.Slot == EMPTY_SLOT || bucket.Slot == REMOVED_SLOT)
+                {
+                    if (bucket.Slot == EMPTY_SLOT)
+                    {
+                        ++_used;
+                    }
+
+                    bucket.Key = key;
+                    bucket.Slot = slot;
+                    ++_size;
+                    return;
+                }
+            }
+        }
+
+        void Remove(uint32 key, uint32 slot)
+        {
+            if (_buckets.empty())
+            {
+                return;
+            }
+
+            for (std::size_t i = Position(key); ; i = (i + 1) & (_buckets.size() - 1))
+            {
+                Bucket& bucket = _buckets[i];
+                if (bucket.Slot == EMPTY_SLOT)
+                {
+                    return;
+                }
+
+                if (bucket.Key == key && bucket.Slot == slot)
+                {
+                    bucket.Slot = REMOVED_SLOT;
+                    --_size;
+                    return;
+                }
+            }
+        }
+
+        void Reserve(std::size_t count)
+        {
+            if (count * 2 > _buckets.size())
+            {
+                Rehash(count * 2);
+            }
+        }
+
+        void Clear()
+        {
+            _buckets.clear();
+            _size = 0;
+            _used = 0;
+            _shift = 64;
+        }
+
+        std::size_t GetMemoryUsage() const { return _buckets.capacity() * sizeof(Bucket); }
+
+    private:
+        // Fibonacci hashing, low guids are sequential and must not end up in neighbouring buckets
+        std::size_t Position(uint32 key) const
+        {
+            return std::size_t((uint64(key) * UI64LIT(0x9E3779B97F4A7C15)) >> _shift);
+        }
+
+        void Rehash(std::size_t minCapacity)
+        {
+            std::size_t capacity = MIN_CAPACITY;
+            uint32 bits = 4;
+            while (capacity < minCapacity)
+            {
+                capacity <<= 1;
+                ++bits;
+            }
+
+            std::vector<Bucket> buckets(capacity, Bucket{ 0, EMPTY_SLOT });
+            std::swap(_buckets, buckets);
+            _shift = 64 - bits;
+            _size = 0;
+            _used = 0;
+
+            for (Bucket const& bucket : buckets)
+            {
+                if (bucket.Slot != EMPTY_SLOT && bucket.Slot != REMOVED_SLOT)
+                {
+                    Insert(bucket.Key, bucket.Slot);
+                }
+            }
+        }
+
+        std::vector<Bucket> _buckets;
+        std::size_t _size;
+        std::size_t _used;
+        uint32 _shift;
+    };
+
+    // entries are never moved, deleted slots are reused by the next added character
+    std::deque<CharacterCacheEntry> _characterCacheStore;
+    std::vector<uint32> _characterCacheFreeSlots;
+    CacheSlotIndex _characterCacheByGuidIndex;
+    CacheSlotIndex _characterCacheByNameIndex;
+
+    uint32 GetNameKey(std::string const& name)
+    {
+        return uint32(std::hash<std::string>()(name));
+    }
+
+    uint32 FindSlotByGuid(ObjectGuid const& guid)
+    {
+        return _characterCacheByGuidIndex.Find(guid.GetCounter(), [&guid](uint32 slot)
+        {
+            return _characterCacheStore[slot].Guid == guid;
+        });
+    }
+
+    uint32 FindSlotByName(std::string const& name)
+    {
+        return _characterCacheByNameIndex.Find(GetNameKey(name), [&name](uint32 slot)
+        {
+            return _characterCacheStore[slot].Name == name;
+        });
+    }
+
+    CharacterCacheEntry* FindByGuid(ObjectGuid const& guid)
+    {
+        uint32 slot = FindSlotByGuid(guid);
+        return slot != CacheSlotIndex::NOT_FOUND ? &_characterCacheStore[slot] : nullptr;
+    }
+
+    CharacterCacheEntry* FindByName(std::string const& name)
+    {
+        uint32 slot = FindSlotByName(name);
+        return slot != CacheSlotIndex::NOT_FOUND ? &_characterCacheStore[slot] : nullptr;
+    }
 }
 
 CharacterCache* CharacterCache::instance()
@@ -61,6 +251,9 @@ CharacterCache* CharacterCache::instance()
 void CharacterCache::LoadCharacterCacheStorage()
 {
     _characterCacheStore.clear();
+    _characterCacheFreeSlots.clear();
+    _characterCacheByGuidIndex.Clear();
+    _characterCacheByNameIndex.Clear();
     uint32 oldMSTime = getMSTime();
 
     QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
@@ -70,6 +263,9 @@ void CharacterCache::LoadCharacterCacheStorage()
         return;
     }
 
+    _characterCacheByGuidIndex.Reserve(result->GetRowCount());
+    _characterCacheByNameIndex.Reserve(result->GetRowCount());
+
     do
     {
         Field* fields = result->Fetch();
@@ -87,10 +283,28 @@ void CharacterCache::LoadCharacterCacheStorage()
         } while (mailCountResult->NextRow());
     }
 
-    LOG_INFO("server.loading", "Loaded character infos for " SZFMTD " characters in %u ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", "Loaded character infos for " SZFMTD " characters (" SZFMTD " KB) in %u ms", _characterCacheStore.size(), GetMemoryUsage() / 1024, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
+std::size_t CharacterCache::GetMemoryUsage() const
+{
+    std::size_t memoryUsage = _characterCacheStore.size() * sizeof(CharacterCacheEntry) + _characterCacheFreeSlots.capacity() * sizeof(uint32) +
+        _characterCacheByGuidIndex.GetMemoryUsage() + _characterCacheByNameIndex.GetMemoryUsage();
+
+    // names longer than the small string buffer (12 non ASCII characters can be, in UTF-8) own a heap buffer
+    std::size_t const smallStringCapacity = std::string().capacity();
+    for (CharacterCacheEntry const& entry : _characterCacheStore)
+    {
+        if (entry.Name.capacity() > smallStringCapacity)
+        {
+            memoryUsage += entry.Name.capacity() + 1;
+        }
+    }
+
+    return memoryUsage;
+}
+
 void CharacterCache::RefreshCacheEntry(uint32 lowGuid)
 {
     QueryResult result = CharacterDatabase.PQuery("SELECT guid, name, account, race, gender, class, level FROM characters WHERE guid = %u", lowGuid);
@@ -122,7 +336,29 @@ Modifying functions
 */
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
+    uint32 slot = FindSlotByGuid(guid);
+    if (slot != CacheSlotIndex::NOT_FOUND)
+    {
+        // overwriting an existing entry, its old name must no longer resolve to it
+        _characterCacheByNameIndex.Remove(GetNameKey(_characterCacheStore[slot].Name), slot);
+    }
+    else
+    {
+        if (!_characterCacheFreeSlots.empty())
+        {
+            slot = _characterCacheFreeSlots.back();
+            _characterCacheFreeSlots.pop_back();
+        }
+        else
+        {
+            slot = uint32(_characterCacheStore.size());
+            _characterCacheStore.emplace_back();
+        }
+
+        _characterCacheByGuidIndex.Insert(guid.GetCounter(), slot);
+    }
+
+    CharacterCacheEntry& data = _characterCacheStore[slot];
     data.Guid = guid;
     data.Name = name;
     data.AccountId = accountId;
@@ -136,120 +372,148 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accou
         data.ArenaTeamId[i] = 0; // Will be set in arena teams loading
     }
 
-    // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    // Fill Name to Guid Store, a character already holding this name loses it like in the old map
+    uint32 oldNameSlot = FindSlotByName(name);
+    if (oldNameSlot != CacheSlotIndex::NOT_FOUND && oldNameSlot != slot)
+    {
+        _characterCacheByNameIndex.Remove(GetNameKey(name), oldNameSlot);
+    }
+
+    _characterCacheByNameIndex.Insert(GetNameKey(name), slot);
 }
 
 void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    uint32 slot = FindSlotByGuid(guid);
+    if (slot != CacheSlotIndex::NOT_FOUND)
+    {
+        CharacterCacheEntry& data = _characterCacheStore[slot];
+        _characterCacheByNameIndex.Remove(GetNameKey(data.Name), slot);
+        _characterCacheByGuidIndex.Remove(guid.GetCounter(), slot);
+
+        data = CharacterCacheEntry();
+        _characterCacheFreeSlots.push_back(slot);
+    }
+
+    uint32 nameSlot = FindSlotByName(name);
+    if (nameSlot != CacheSlotIndex::NOT_FOUND)
+    {
+        _characterCacheByNameIndex.Remove(GetNameKey(name), nameSlot);
+    }
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 slot = FindSlotByGuid(guid);
+    if (slot == CacheSlotIndex::NOT_FOUND)
         return;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+    CharacterCacheEntry& data = _characterCacheStore[slot];
+
+    // Correct name -> slot index
+    _characterCacheByNameIndex.Remove(GetNameKey(data.Name), slot);
+
+    data.Name = name;
 
     if (gender)
     {
-        itr->second.Sex = *gender;
+        data.Sex = *gender;
     }
 
     if (race)
     {
-        itr->second.Race = *race;
+        data.Race = *race;
     }
 
     //WorldPackets::Misc::InvalidatePlayer packet(guid);
     //sWorld->SendGlobalMessage(packet.Write());
 
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
+    uint32 oldNameSlot = FindSlotByName(name);
+    if (oldNameSlot != CacheSlotIndex::NOT_FOUND)
+    {
+        _characterCacheByNameIndex.Remove(GetNameKey(name), oldNameSlot);
+    }
+
+    _characterCacheByNameIndex.Insert(GetNameKey(name), slot);
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry* data = FindByGuid(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.Level = level;
+    data->Level = level;
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry* data = FindByGuid(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.AccountId = accountId;
+    data->AccountId = accountId;
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry* data = FindByGuid(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.GuildId = guildId;
+    data->GuildId = guildId;
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry* data = FindByGuid(guid);
+    if (!data)
     {
         return;
     }
 
     ASSERT(slot < 3);
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    data->ArenaTeamId[slot] = arenaTeamId;
 }
 
 void CharacterCache::UpdateCharacterMailCount(ObjectGuid const& guid, int8 count, bool update)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry* data = FindByGuid(guid);
+    if (!data)
     {
         return;
     }
 
     if (update)
     {
-        itr->second.MailCount = count;
+        data->MailCount = count;
         return;
     }
 
     // Let's be safe and prevent overflow
-    if (!itr->second.MailCount && count < 0)
+    if (!data->MailCount && count < 0)
     {
         return;
     }
 
-    itr->second.MailCount += count;
+    data->MailCount += count;
 }
 
 void CharacterCache::UpdateCharacterGroup(ObjectGuid const& guid, ObjectGuid groupGUID)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry* data = FindByGuid(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.GroupGuid = groupGUID;
+    data->GroupGuid = groupGUID;
 }
 
 /*
@@ -257,37 +521,24 @@ Getters
 */
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return FindByGuid(guid) != nullptr;
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
-    {
-        return &itr->second;
-    }
-
-    return nullptr;
+    return FindByGuid(guid);
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-    {
-        return itr->second;
-    }
-
-    return nullptr;
+    return FindByName(name);
 }
 
 ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
+    if (CharacterCacheEntry const* data = FindByName(name))
     {
-        return itr->second->Guid;
+        return data->Guid;
     }
 
     return ObjectGuid::Empty;
@@ -295,44 +546,43 @@ ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindByGuid(guid);
+    if (!data)
     {
         return false;
     }
 
-    name = itr->second.Name;
+    name = data->Name;
     return true;
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindByGuid(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return Player::TeamIdForRace(itr->second.Race);
+    return Player::TeamIdForRace(data->Race);
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindByGuid(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return itr->second.AccountId;
+    return data->AccountId;
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
+    if (CharacterCacheEntry const* data = FindByName(name))
     {
-        return itr->second->AccountId;
+        return data->AccountId;
     }
 
     return 0;
@@ -340,44 +590,44 @@ uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) cons
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindByGuid(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return itr->second.Level;
+    return data->Level;
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindByGuid(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return itr->second.GuildId;
+    return data->GuildId;
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindByGuid(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return itr->second.ArenaTeamId[type];
+    return data->ArenaTeamId[type];
 }
 
 ObjectGuid CharacterCache::GetCharacterGroupGuidByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindByGuid(guid);
+    if (!data)
     {
         return ObjectGuid::Empty;
     }
 
-    return itr->second.GroupGuid;
+    return data->GroupGuid;
 }
@@ -60,4 +60,110 @@ void WhoListCacheMgr::Update()
             (player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId()), player->getGender(), player->IsVisible(),
             widePlayerName, wideGuildName, playerName, guildName);
     }
+
+    // build the query indexes, they list storage positions so results keep the storage order
+    for (WhoListIndexVector& entries : _levelIndex)
+        entries.clear();
+
+    for (auto& [zoneId, entries] : _zoneIndex)
+        entries.clear();
+
+    _playerNameIndex.clear();
+    _guildNameIndex.clear();
+
+    for (uint32 i = 0; i < _whoListStorage.size(); ++i)
+    {
+        WhoListPlayerInfo const& info = _whoListStorage[i];
+        _levelIndex[std::min<uint32>(info.GetLevel(), STRONG_MAX_LEVEL)].push_back(i);
+        _zoneIndex[info.GetZoneId()].push_back(i);
+        AddToNameIndex(_playerNameIndex, info.GetWidePlayerName(), i);
+        AddToNameIndex(_guildNameIndex, info.GetWideGuildName(), i);
+    }
+}
+
+namespace
+{
+    // characters of a name substring packed in one key, 21 bits cover every unicode code point
+    bool GetNameKey(std::wstring const& name, std::size_t offset, std::size_t length, uint64& key)
+    {
+        if (offset + length > name.size())
+            return false;
+
+        key = 0;
+        for (std::size_t i = 0; i < length; ++i)
+            key = (key << 21) | (uint64(name[offset + i]) & 0x1FFFFF);
+
+        return true;
+    }
+}
+
+void WhoListCacheMgr::AddToNameIndex(NameIndex& index, std::wstring const& name, uint32 position)
+{
+    uint64 key;
+    for (std::size_t offset = 0; GetNameKey(name, offset, NAME_INDEX_LENGTH, key); ++offset)
+    {
+        WhoListIndexVector& entries = index[key];
+        if (entries.empty() || entries.back() != position)
+            entries.push_back(position);
+    }
+}
+
+bool WhoListCacheMgr::GetNameCandidates(NameIndex const& index, std::wstring const& namePart, WhoListIndexVector const*& positions)
+{
+    static WhoListIndexVector const noEntries;
+
+    if (namePart.size() < NAME_INDEX_LENGTH)
+        return false;
+
+    // every substring of namePart is in a matching name, the rarest one gives the fewest candidates
+    positions = nullptr;
+    uint64 key;
+    for (std::size_t offset = 0; GetNameKey(namePart, offset, NAME_INDEX_LENGTH, key); ++offset)
+    {
+        auto itr = index.find(key);
+        if (itr == index.end())
+        {
+            positions = &noEntries;
+            break;
+        }
+
+        if (!positions || itr->second.size() < positions->size())
+            positions = &itr->second;
+    }
+
+    return true;
+}
+
+std::size_t WhoListCacheMgr::GetLevelRangeCount(uint32 levelMin, uint32 levelMax) const
+{
+    std::size_t count = 0;
+    for (uint32 level = levelMin; level <= std::min<uint32>(levelMax, STRONG_MAX_LEVEL); ++level)
+        count += _levelIndex[level].size();
+
+    return count;
+}
+
+void WhoListCacheMgr::AppendLevelRangeEntries(uint32 levelMin, uint32 levelMax, WhoListIndexVector& positions) const
+{
+    for (uint32 level = levelMin; level <= std::min<uint32>(levelMax, STRONG_MAX_LEVEL); ++level)
+        positions.insert(positions.end(), _levelIndex[level].begin(), _levelIndex[level].end());
+}
+
+WhoListIndexVector const* WhoListCacheMgr::GetZoneEntries(uint32 zoneId) const
+{
+    auto itr = _zoneIndex.find(zoneId);
+    if (itr == _zoneIndex.end() || itr->second.empty())
+        return nullptr;
+
+    return &itr->second;
+}
+
+bool WhoListCacheMgr::GetPlayerNameCandidates(std::wstring const& namePart, WhoListIndexVector const*& positions) const
+{
+    return GetNameCandidates(_playerNameIndex, namePart, positions);
+}
+
+bool WhoListCacheMgr::GetGuildNameCandidates(std::wstring const& namePart, WhoListIndexVector const*& positions) const
+{
+    return GetNameCandidates(_guildNameIndex, namePart, positions);
 }
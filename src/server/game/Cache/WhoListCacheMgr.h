@@ -19,8 +19,11 @@
 #define _WHO_LISTCACHE_H_
 
 #include "Common.h"
+#include "DBCEnums.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <array>
+#include <unordered_map>
 
 class WhoListPlayerInfo
 {
@@ -72,6 +75,7 @@ private:
 };
 
 using WhoListInfoVector = std::vector<WhoListPlayerInfo>;
+using WhoListIndexVector = std::vector<uint32>;
 
 class AC_GAME_API WhoListCacheMgr
 {
@@ -89,8 +93,35 @@ public:
     void Update();
     WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
 
+    /// All index lookups below return positions in GetWhoList(), in ascending order
+
+    /// Number of entries with level in [levelMin, levelMax]
+    std::size_t GetLevelRangeCount(uint32 levelMin, uint32 levelMax) const;
+
+    /// Appends the positions of the entries with level in [levelMin, levelMax], not sorted across levels
+    void AppendLevelRangeEntries(uint32 levelMin, uint32 levelMax, WhoListIndexVector& positions) const;
+
+    /// Positions of the entries in given zone, nullptr if there are none
+    WhoListIndexVector const* GetZoneEntries(uint32 zoneId) const;
+
+    /// Positions of the entries whose lower case player or guild name may contain namePart (lower case too),
+    /// every other entry does not. Returns false if namePart is too short for the index, any entry may match then.
+    bool GetPlayerNameCandidates(std::wstring const& namePart, WhoListIndexVector const*& positions) const;
+    bool GetGuildNameCandidates(std::wstring const& namePart, WhoListIndexVector const*& positions) const;
+
 protected:
-    WhoListInfoVector _whoListStorage;
+    // substrings of NAME_INDEX_LENGTH characters of the names to the entries containing them
+    typedef std::unordered_map<uint64, WhoListIndexVector> NameIndex;
+    static constexpr std::size_t NAME_INDEX_LENGTH = 3;
+
+    static void AddToNameIndex(NameIndex& index, std::wstring const& name, uint32 position);
+    static bool GetNameCandidates(NameIndex const& index, std::wstring const& namePart, WhoListIndexVector const*& positions);
+
+    WhoListInfoVector _whoListStorage;                      // in ObjectAccessor order, like the results sent before the indexes existed
+    std::array<WhoListIndexVector, STRONG_MAX_LEVEL + 1> _levelIndex;
+    std::unordered_map<uint32, WhoListIndexVector> _zoneIndex;
+    NameIndex _playerNameIndex;
+    NameIndex _guildNameIndex;
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
@@ -939,16 +939,19 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
+    // one copy shared by every member's socket instead of one per member
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->GetSession()->SendPacket(data);
+            i->second.plrPtr->GetSession()->SendPacket(packet);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (i->first != who)
-            i->second.plrPtr->GetSession()->SendPacket(data);
+            i->second.plrPtr->GetSession()->SendPacket(packet);
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
@@ -959,8 +962,9 @@ void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
 
 void Channel::SendToAllWatching(WorldPacket* data)
 {
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
     for (PlayersWatchingContainer::const_iterator i = playersWatchingStore.begin(); i != playersWatchingStore.end(); ++i)
-        (*i)->GetSession()->SendPacket(data);
+        (*i)->GetSession()->SendPacket(packet);
 }
 
 void Channel::Voice(ObjectGuid /*guid1*/, ObjectGuid /*guid2*/)
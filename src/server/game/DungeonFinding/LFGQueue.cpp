@@ -29,6 +29,66 @@
 
 namespace lfg
 {
+    namespace
+    {
+        // role subsets are 3 bit masks: tank = 1, healer = 2, damage = 4
+        constexpr uint8 GetRoleSubset(uint8 roles)
+        {
+            return (roles >> 1) & 0x7; // PLAYER_ROLE_TANK..PLAYER_ROLE_DAMAGE, leader flag dropped
+        }
+
+        // how many players a group can take whose roles all lie inside the given subset
+        constexpr uint64 GetRoleSubsetCapacity(uint8 subset)
+        {
+            return ((subset & 0x1) ? LFG_TANKS_NEEDED : 0) + ((subset & 0x2) ? LFG_HEALERS_NEEDED : 0) + ((subset & 0x4) ? LFG_DPS_NEEDED : 0);
+        }
+
+        constexpr uint64 BuildRoleCapacityTable()
+        {
+            uint64 table = 0;
+            for (uint8 subset = 0; subset < 8; ++subset)
+                table |= GetRoleSubsetCapacity(subset) << (subset * 8);
+            return table;
+        }
+
+        constexpr uint64 ROLE_CAPACITY_TABLE = BuildRoleCapacityTable();
+        constexpr uint64 ROLE_FIT_HIGH_BITS = 0x8080808080808080;
+    }
+
+    void LfgQueueData::BuildMatchData()
+    {
+        dungeonMask.reset();
+        dungeonMaskComplete = true;
+        for (uint32 dungeonId : dungeons)
+        {
+            if (dungeonId < LFG_DUNGEON_MASK_SIZE)
+                dungeonMask.set(dungeonId);
+            else
+                dungeonMaskComplete = false;
+        }
+
+        roleFit = 0;
+        for (LfgRolesMap::const_iterator itr = roles.begin(); itr != roles.end(); ++itr)
+        {
+            uint8 playerRoles = GetRoleSubset(itr->second);
+            for (uint8 subset = 0; subset < 8; ++subset)
+                if (!(playerRoles & ~subset))
+                    roleFit += uint64(1) << (subset * 8);
+        }
+    }
+
+    /**
+       Checks if players with the given summed LfgQueueData::roleFit can all get a role in one group.
+       By Hall's theorem that is the case when no role subset is wanted by more players than it has
+       free slots, so it is a per byte comparison with a precomputed capacity table.
+       Does not assign roles, LFGMgr::CheckGroupRoles still does that for combinations passing this.
+    */
+    bool LFGQueue::CanFillRoles(uint64 roleFit)
+    {
+        // every byte is at most MAXGROUPSIZE, so the subtraction never borrows across bytes
+        return (((ROLE_CAPACITY_TABLE | ROLE_FIT_HIGH_BITS) - roleFit) & ROLE_FIT_HIGH_BITS) == ROLE_FIT_HIGH_BITS;
+    }
+
     void LFGQueue::AddToQueue(ObjectGuid guid, bool failedProposal)
     {
         LOG_DEBUG("lfg", "ADD AddToQueue: %s, failed proposal: %u", guid.ToString().c_str(), failedProposal ? 1 : 0);
@@ -201,16 +261,12 @@ namespace lfg
 
         // we have to take into account that FindNewGroups is called every X minutes if number of compatibles is low!
         // build set of already present compatibles for this guid
-        std::set<Lfg5Guids> currentCompatibles;
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
+        std::vector<Lfg5Guids> currentCompatibles;
+        for (Lfg5GuidsList::const_iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
             if (it->hasGuid(newGuid))
-            {
-                // unset roles here so they are not copied, restore after insertion
-                LfgRolesMap* r = it->roles;
-                it->roles = nullptr;
-                currentCompatibles.insert(*it);
-                it->roles = r;
-            }
+                currentCompatibles.emplace_back(*it, false); // roles are not needed for lookups
+
+        std::sort(currentCompatibles.begin(), currentCompatibles.end());
 
         LfgCompatibility selfCompatibility = LFG_COMPATIBILITY_PENDING;
         if (currentCompatibles.empty())
@@ -239,7 +295,7 @@ namespace lfg
         return selfCompatibility;
     }
 
-    LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles)
+    LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, std::vector<Lfg5Guids> const& currentCompatibles)
     {
         LOG_DEBUG("lfg", "CHECK CheckCompatibility: %s, new guid: %s", checkWith.toString().c_str(), newGuid.ToString().c_str());
         Lfg5Guids check(checkWith, false); // here newGuid is at front
@@ -247,7 +303,7 @@ namespace lfg
         check.force_insert_front(newGuid);
         strGuids.insert(newGuid);
 
-        if (!currentCompatibles.empty() && currentCompatibles.find(strGuids) != currentCompatibles.end())
+        if (!currentCompatibles.empty() && std::binary_search(currentCompatibles.begin(), currentCompatibles.end(), strGuids))
             return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
 
         LfgProposal proposal;
@@ -261,6 +317,12 @@ namespace lfg
         ObjectGuid guid;
         uint64 addToFoundMask = 0;
 
+        // queue data of every guid in check, with the summed role fit and intersected dungeon bitsets
+        std::array<LfgQueueData const*, 5> queueData = { };
+        uint64 roleFit = 0;
+        LfgDungeonMask dungeonMask;
+        bool dungeonMaskComplete = true;
+
         for (uint8 i = 0; i < 5 && !(guid = check.guids[i]).IsEmpty() && numLfgGroups < 2 && numPlayers <= MAXGROUPSIZE; ++i)
         {
             LfgQueueDataContainer::iterator itQueue = QueueDataStore.find(guid);
@@ -271,6 +333,12 @@ namespace lfg
                 return LFG_COMPATIBILITY_PENDING;
             }
 
+            LfgQueueData const& data = itQueue->second;
+            queueData[i] = &data;
+            roleFit += data.roleFit;
+            dungeonMask = i ? (dungeonMask & data.dungeonMask) : data.dungeonMask;
+            dungeonMaskComplete = dungeonMaskComplete && data.dungeonMaskComplete;
+
             // Store group so we don't need to call Mgr to get it later (if it's player group will be 0 otherwise would have joined as group)
             for (LfgRolesMap::const_iterator it2 = itQueue->second.roles.begin(); it2 != itQueue->second.roles.end(); ++it2)
                 proposalGroups[it2->first] = itQueue->first.IsGroup() ? itQueue->first : ObjectGuid::Empty;
@@ -309,9 +377,16 @@ namespace lfg
         // If it's single group no need to check for duplicate players, ignores, bad roles or bad dungeons as it's been checked before joining
         if (check.size() > 1)
         {
+            // cheap rejections first, most combinations fail here without touching any map
+            if (!CanFillRoles(roleFit))
+                return LFG_INCOMPATIBLES_NO_ROLES;
+
+            if (dungeonMaskComplete && dungeonMask.none())
+                return LFG_INCOMPATIBLES_NO_DUNGEONS;
+
             for (uint8 i = 0; i < 5 && check.guids[i]; ++i)
             {
-                const LfgRolesMap& roles = QueueDataStore[check.guids[i]].roles;
+                const LfgRolesMap& roles = queueData[i]->roles;
                 for (LfgRolesMap::const_iterator itRoles = roles.begin(); itRoles != roles.end(); ++itRoles)
                 {
                     LfgRolesMap::const_iterator itPlayer;
@@ -364,13 +439,23 @@ namespace lfg
             else
                 addToFoundMask |= (((uint64)1) << (roleCheckResult - 1));
 
-            proposalDungeons = QueueDataStore[check.front()].dungeons;
-            for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+            if (dungeonMaskComplete)
             {
-                LfgDungeonSet temporal;
-                LfgDungeonSet& dungeons = QueueDataStore[check.guids[i]].dungeons;
-                std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
-                proposalDungeons = temporal;
+                // the bitset already holds the intersection, only translate it back
+                for (uint32 dungeonId : queueData[0]->dungeons)
+                    if (dungeonMask.test(dungeonId))
+                        proposalDungeons.insert(proposalDungeons.end(), dungeonId);
+            }
+            else
+            {
+                proposalDungeons = queueData[0]->dungeons;
+                for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+                {
+                    LfgDungeonSet temporal;
+                    LfgDungeonSet const& dungeons = queueData[i]->dungeons;
+                    std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
+                    proposalDungeons = temporal;
+                }
             }
 
             if (proposalDungeons.empty())
@@ -378,8 +463,7 @@ namespace lfg
         }
         else
         {
-            ObjectGuid gguid = check.front();
-            const LfgQueueData& queue = QueueDataStore[gguid];
+            const LfgQueueData& queue = *queueData[0];
             proposalDungeons = queue.dungeons;
             proposalRoles = queue.roles;
             LFGMgr::CheckGroupRoles(proposalRoles);          // assing new roles
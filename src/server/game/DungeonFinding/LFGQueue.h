@@ -19,6 +19,7 @@
 #define _LFGQUEUE_H
 
 #include "LFG.h"
+#include <bitset>
 
 namespace lfg
 {
@@ -36,17 +37,25 @@ namespace lfg
         LFG_COMPATIBLES_MATCH                                  // Must be the last one
     };
 
+    /// Dungeon ids below this value are mirrored in LfgQueueData::dungeonMask
+    constexpr uint32 LFG_DUNGEON_MASK_SIZE = 1024;
+    typedef std::bitset<LFG_DUNGEON_MASK_SIZE> LfgDungeonMask;
+
     /// Stores player or group queue info
     struct LfgQueueData
     {
         LfgQueueData(): joinTime(time_t(time(nullptr))), lastRefreshTime(joinTime), tanks(LFG_TANKS_NEEDED),
-            healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED)
+            healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED), dungeonMaskComplete(true), roleFit(0)
         { }
 
         LfgQueueData(time_t _joinTime, LfgDungeonSet const& _dungeons, LfgRolesMap const& _roles):
             joinTime(_joinTime), lastRefreshTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
             dps(LFG_DPS_NEEDED), dungeons(_dungeons), roles(_roles)
-        { }
+        {
+            BuildMatchData();
+        }
+
+        void BuildMatchData();
 
         time_t joinTime;                                       ///< Player queue join time (to calculate wait times)
         time_t lastRefreshTime;                                ///< pussywizard
@@ -56,6 +65,9 @@ namespace lfg
         LfgDungeonSet dungeons;                                ///< Selected Player/Group Dungeon/s
         LfgRolesMap roles;                                     ///< Selected Player Role/s
         Lfg5Guids bestCompatible;                              ///< Best compatible combination of people queued
+        LfgDungeonMask dungeonMask;                            ///< Bitset copy of dungeons, used to reject combinations quickly
+        bool dungeonMaskComplete;                              ///< False if some dungeon id did not fit into dungeonMask
+        uint64 roleFit;                                        ///< Byte N counts players whose roles all fit in role subset N (see LFGQueue::CanFillRoles)
     };
 
     struct LfgWaitTime
@@ -107,7 +119,9 @@ namespace lfg
         void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, Lfg5Guids const& key);
 
         LfgCompatibility FindNewGroups(const ObjectGuid& newGuid);
-        LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles);
+        LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, std::vector<Lfg5Guids> const& currentCompatibles);
+
+        static bool CanFillRoles(uint64 roleFit);
 
         // Queue
         uint32 m_QueueStatusTimer;                         ///< used to check interval of sending queue status
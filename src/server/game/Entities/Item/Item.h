@@ -345,6 +345,7 @@ public:
 
     // Soulbound trade system
     void SetSoulboundTradeable(AllowedLooterSet& allowedLooters);
+    [[nodiscard]] AllowedLooterSet const& GetSoulboundTradeableLooters() const { return allowedGUIDs; }
     void ClearSoulboundTradeable(Player* currentOwner);
     bool CheckSoulboundTradeExpire();
 
@@ -81,6 +81,7 @@ Object::Object() : m_PackGUID(sizeof(uint64) + 1)
 
     m_inWorld           = false;
     m_objectUpdated     = false;
+    m_hasDeferredValues = false;
 
     sScriptMgr->OnConstructObject(this);
 }
@@ -304,12 +305,20 @@ void Object::DestroyForPlayer(Player* target, bool onDeath) const
 [[nodiscard]] int32 Object::GetInt32Value(uint16 index) const
 {
     ASSERT(index < m_valuesCount || PrintIndexError(index, false));
+
+    if (m_hasDeferredValues)
+        const_cast<Object*>(this)->OnDeferredValueRead(index);
+
     return m_int32Values[index];
 }
 
 [[nodiscard]] uint32 Object::GetUInt32Value(uint16 index) const
 {
     ASSERT(index < m_valuesCount || PrintIndexError(index, false));
+
+    if (m_hasDeferredValues)
+        const_cast<Object*>(this)->OnDeferredValueRead(index);
+
     return m_uint32Values[index];
 }
 
@@ -322,6 +331,10 @@ void Object::DestroyForPlayer(Player* target, bool onDeath) const
 [[nodiscard]] float Object::GetFloatValue(uint16 index) const
 {
     ASSERT(index < m_valuesCount || PrintIndexError(index, false));
+
+    if (m_hasDeferredValues)
+        const_cast<Object*>(this)->OnDeferredValueRead(index);
+
     return m_floatValues[index];
 }
 
@@ -329,6 +342,10 @@ void Object::DestroyForPlayer(Player* target, bool onDeath) const
 {
     ASSERT(index < m_valuesCount || PrintIndexError(index, false));
     ASSERT(offset < 4);
+
+    if (m_hasDeferredValues)
+        const_cast<Object*>(this)->OnDeferredValueRead(index);
+
     return *(((uint8*) &m_uint32Values[index]) + offset);
 }
 
@@ -336,6 +353,10 @@ void Object::DestroyForPlayer(Player* target, bool onDeath) const
 {
     ASSERT(index < m_valuesCount || PrintIndexError(index, false));
     ASSERT(offset < 2);
+
+    if (m_hasDeferredValues)
+        const_cast<Object*>(this)->OnDeferredValueRead(index);
+
     return *(((uint16*) &m_uint32Values[index]) + offset);
 }
 
@@ -125,6 +125,10 @@ public:
     [[nodiscard]] uint16 GetUInt16Value(uint16 index, uint8 offset) const;
     [[nodiscard]] ObjectGuid GetGuidValue(uint16 index) const;
 
+    // some values are only recalculated when read or right before the object update is sent, see Player::DeferStatUpdate
+    [[nodiscard]] bool HasDeferredValues() const { return m_hasDeferredValues; }
+    virtual void UpdateDeferredValues() { }
+
     void SetInt32Value(uint16 index, int32 value);
     void SetUInt32Value(uint16 index, uint32 value);
     void UpdateUInt32Value(uint16 index, uint32 value);
@@ -232,7 +236,11 @@ protected:
     virtual void RemoveFromObjectUpdate() = 0;
     void AddToObjectUpdateIfNeeded();
 
+    // called by the value getters while m_hasDeferredValues is set
+    virtual void OnDeferredValueRead(uint16 /*index*/) { }
+
     bool m_objectUpdated;
+    bool m_hasDeferredValues;
 
 private:
     bool m_inWorld;
@@ -325,6 +325,11 @@ Player::Player(WorldSession* session): Unit(true), m_mover(this)
     m_baseHealthRegen = 0;
     m_spellPenetrationItemMod = 0;
 
+    m_statUpdateBatchDepth = 0;
+    m_deferredStatUpdates = 0;
+    m_runningStatUpdate = 0;
+    m_flushingStatUpdates = false;
+
     // Honor System
     m_lastHonorUpdateTime = time(nullptr);
 
@@ -1687,6 +1692,9 @@ void Player::RemoveFromWorld()
             m_session->DoLootRelease(lguid);
         sOutdoorPvPMgr->HandlePlayerLeaveZone(this, m_zoneUpdateId);
         sBattlefieldMgr->HandlePlayerLeaveZone(this, m_zoneUpdateId);
+
+        // stats deferred until the end of the tick, out of world they are no longer deferred
+        FlushStatUpdates();
     }
 
     // Remove items from world before self - player must be found in Item::RemoveFromObjectUpdate
@@ -6321,6 +6329,8 @@ void Player::_ApplyItemMods(Item* item, uint8 slot, bool apply)
 
     LOG_DEBUG("entities.player", "applying mods for item %s ", item->GetGUID().ToString().c_str());
 
+    StatUpdateBatch batch(this);
+
     uint8 attacktype = Player::GetAttackBySlot(slot);
 
     if (item->HasSocket())                              //only (un)equipping of items with sockets can influence metagems, so no need to waste time with normal items
@@ -7232,6 +7242,8 @@ void Player::_RemoveAllItemMods()
 {
     LOG_DEBUG("entities.player.items", "_RemoveAllItemMods start.");
 
+    StatUpdateBatch batch(this);
+
     for (uint8 i = 0; i < INVENTORY_SLOT_BAG_END; ++i)
     {
         if (m_items[i])
@@ -7280,6 +7292,8 @@ void Player::_ApplyAllItemMods()
 {
     LOG_DEBUG("entities.player.items", "_ApplyAllItemMods start.");
 
+    StatUpdateBatch batch(this);
+
     for (uint8 i = 0; i < INVENTORY_SLOT_BAG_END; ++i)
     {
         if (m_items[i])
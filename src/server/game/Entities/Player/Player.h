@@ -1237,6 +1237,8 @@ public:
     [[nodiscard]] InventoryResult CanUnequipItem(uint16 src, bool swap) const;
     InventoryResult CanBankItem(uint8 bag, uint8 slot, ItemPosCountVec& dest, Item* pItem, bool swap, bool not_loading = true) const;
     InventoryResult CanUseItem(Item* pItem, bool not_loading = true) const;
+    // checks of CanUseItem(Item*) that do not depend on the item instance (alive and soulbound checks)
+    InventoryResult CanUseItemInstanceOf(ItemTemplate const* pProto) const;
     [[nodiscard]] bool HasItemTotemCategory(uint32 TotemCategory) const;
     bool IsTotemCategoryCompatiableWith(const ItemTemplate* pProto, uint32 requiredTotemCategoryId) const;
     InventoryResult CanUseItem(ItemTemplate const* pItem) const;
@@ -1929,6 +1931,14 @@ public:
     void UpdateManaRegen();
     void UpdateRuneRegen(RuneType rune);
 
+    // Derived values (attack power, crit, dodge, spell power, regen...) of a player in world are only
+    // recalculated, once and in dependency order, when one of their fields is read or right before the
+    // object update is sent. Out of world they are recalculated when the outermost batch ends.
+    void BeginStatUpdateBatch() { ++m_statUpdateBatchDepth; }
+    void EndStatUpdateBatch();
+    void FlushStatUpdates();
+    void UpdateDeferredValues() override { FlushStatUpdates(); }
+
     [[nodiscard]] ObjectGuid GetLootGUID() const { return m_lootGuid; }
     void SetLootGUID(ObjectGuid guid) { m_lootGuid = guid; }
 
@@ -2558,7 +2568,13 @@ public:
     void SetMountBlockId(uint32 mount) { m_MountBlockId = mount; }
 
     [[nodiscard]] float GetRealParry() const { return m_realParry; }
-    [[nodiscard]] float GetRealDodge() const { return m_realDodge; }
+    [[nodiscard]] float GetRealDodge() const
+    {
+        if (m_deferredStatUpdates & DEFERRED_STAT_UPDATE_DODGE)
+            const_cast<Player*>(this)->FlushStatUpdates();
+
+        return m_realDodge;
+    }
     // mt maps
     [[nodiscard]] const PlayerTalentMap& GetTalentMap() const { return m_talents; }
     [[nodiscard]] uint32 GetNextSave() const { return m_nextSave; }
@@ -2769,6 +2785,26 @@ public:
     uint32 m_baseHealthRegen;
     int32 m_spellPenetrationItemMod;
 
+    enum DeferredStatUpdate : uint32
+    {
+        DEFERRED_STAT_UPDATE_ATTACK_POWER           = 0x01,
+        DEFERRED_STAT_UPDATE_RANGED_ATTACK_POWER    = 0x02,
+        DEFERRED_STAT_UPDATE_CRIT                   = 0x04,
+        DEFERRED_STAT_UPDATE_DODGE                  = 0x08,
+        DEFERRED_STAT_UPDATE_SPELL_CRIT             = 0x10,
+        DEFERRED_STAT_UPDATE_SHIELD_BLOCK           = 0x20,
+        DEFERRED_STAT_UPDATE_SPELL_DAMAGE           = 0x40,
+        DEFERRED_STAT_UPDATE_MANA_REGEN             = 0x80
+    };
+
+    bool DeferStatUpdate(DeferredStatUpdate update);
+    void OnDeferredValueRead(uint16 index) override;
+
+    uint32 m_statUpdateBatchDepth;
+    uint32 m_deferredStatUpdates;
+    uint32 m_runningStatUpdate;
+    bool m_flushingStatUpdates;
+
     SpellModList m_spellMods[MAX_SPELLMOD];
     //uint32 m_pad;
     //        Spell* m_spellModTakingSpell;  // Spell for which charges are dropped in spell::finish
@@ -2945,6 +2981,29 @@ private:
     Optional<float> _farSightDistance = { };
 };
 
+// Opens a stat update batch on the unit for the lifetime of the object, if the unit is a player
+class StatUpdateBatch
+{
+public:
+    explicit StatUpdateBatch(Unit* unit) : _player(unit->ToPlayer())
+    {
+        if (_player)
+            _player->BeginStatUpdateBatch();
+    }
+
+    ~StatUpdateBatch()
+    {
+        if (_player)
+            _player->EndStatUpdateBatch();
+    }
+
+private:
+    Player* _player;
+
+    StatUpdateBatch(StatUpdateBatch const&) = delete;
+    StatUpdateBatch& operator=(StatUpdateBatch const&) = delete;
+};
+
 void AddItemsSetItem(Player* player, Item* item);
 void RemoveItemsSetItem(Player* player, ItemTemplate const* proto);
 
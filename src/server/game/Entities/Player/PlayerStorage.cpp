@@ -2258,45 +2258,53 @@ InventoryResult Player::CanUseItem(Item* pItem, bool not_loading) const
             if (pItem->IsBindedNotWith(this))
                 return EQUIP_ERR_DONT_OWN_THAT_ITEM;
 
-            InventoryResult res = CanUseItem(pProto);
-            if (res != EQUIP_ERR_OK)
-                return res;
+            return CanUseItemInstanceOf(pProto);
+        }
+    }
+    return EQUIP_ERR_ITEM_NOT_FOUND;
+}
 
-            if (pItem->GetSkill() != 0)
-            {
-                bool allowEquip = false;
-                uint32 itemSkill = pItem->GetSkill();
-                // Armor that is binded to account can "morph" from plate to mail, etc. if skill is not learned yet.
-                if (pProto->Quality == ITEM_QUALITY_HEIRLOOM && pProto->Class == ITEM_CLASS_ARMOR && !HasSkill(itemSkill))
-                {
-                    // TODO: when you right-click already equipped item it throws EQUIP_ERR_NO_REQUIRED_PROFICIENCY.
+InventoryResult Player::CanUseItemInstanceOf(ItemTemplate const* pProto) const
+{
+    if (!pProto)
+        return EQUIP_ERR_ITEM_NOT_FOUND;
 
-                    // In fact it's a visual bug, everything works properly... I need sniffs of operations with
-                    // binded to account items from off server.
+    InventoryResult res = CanUseItem(pProto);
+    if (res != EQUIP_ERR_OK)
+        return res;
 
-                    switch (getClass())
-                    {
-                        case CLASS_HUNTER:
-                        case CLASS_SHAMAN:
-                            allowEquip = (itemSkill == SKILL_MAIL);
-                            break;
-                        case CLASS_PALADIN:
-                        case CLASS_WARRIOR:
-                            allowEquip = (itemSkill == SKILL_PLATE_MAIL);
-                            break;
-                    }
-                }
-                if (!allowEquip && GetSkillValue(itemSkill) == 0)
-                    return EQUIP_ERR_NO_REQUIRED_PROFICIENCY;
-            }
+    if (pProto->GetSkill() != 0)
+    {
+        bool allowEquip = false;
+        uint32 itemSkill = pProto->GetSkill();
+        // Armor that is binded to account can "morph" from plate to mail, etc. if skill is not learned yet.
+        if (pProto->Quality == ITEM_QUALITY_HEIRLOOM && pProto->Class == ITEM_CLASS_ARMOR && !HasSkill(itemSkill))
+        {
+            // TODO: when you right-click already equipped item it throws EQUIP_ERR_NO_REQUIRED_PROFICIENCY.
 
-            if (pProto->RequiredReputationFaction && uint32(GetReputationRank(pProto->RequiredReputationFaction)) < pProto->RequiredReputationRank)
-                return EQUIP_ERR_CANT_EQUIP_REPUTATION;
+            // In fact it's a visual bug, everything works properly... I need sniffs of operations with
+            // binded to account items from off server.
 
-            return EQUIP_ERR_OK;
+            switch (getClass())
+            {
+                case CLASS_HUNTER:
+                case CLASS_SHAMAN:
+                    allowEquip = (itemSkill == SKILL_MAIL);
+                    break;
+                case CLASS_PALADIN:
+                case CLASS_WARRIOR:
+                    allowEquip = (itemSkill == SKILL_PLATE_MAIL);
+                    break;
+            }
         }
+        if (!allowEquip && GetSkillValue(itemSkill) == 0)
+            return EQUIP_ERR_NO_REQUIRED_PROFICIENCY;
     }
-    return EQUIP_ERR_ITEM_NOT_FOUND;
+
+    if (pProto->RequiredReputationFaction && uint32(GetReputationRank(pProto->RequiredReputationFaction)) < pProto->RequiredReputationRank)
+        return EQUIP_ERR_CANT_EQUIP_REPUTATION;
+
+    return EQUIP_ERR_OK;
 }
 
 InventoryResult Player::CanUseItem(ItemTemplate const* proto) const
@@ -46,6 +46,9 @@ constexpr auto CINEMATIC_LOOKAHEAD  = 2000;
 
 void Player::Update(uint32 p_time)
 {
+    // a StatUpdateBatch must never outlive the scope that opened it
+    ASSERT(!m_statUpdateBatchDepth);
+
     if (!IsInWorld())
         return;
 
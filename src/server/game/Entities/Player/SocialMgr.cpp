@@ -24,7 +24,7 @@
 #include "WorldPacket.h"
 #include "WorldSession.h"
 
-PlayerSocial::PlayerSocial(): m_playerGUID() { }
+PlayerSocial::PlayerSocial(): m_playerGUID(), m_ignoreCount(0) { }
 
 uint32 PlayerSocial::GetNumberOfSocialsWithFlag(SocialFlag flag) const
 {
@@ -68,6 +68,8 @@ bool PlayerSocial::AddToSocialList(ObjectGuid friendGuid, SocialFlag flag)
 
         CharacterDatabase.Execute(stmt);
     }
+
+    _updateIgnoreCount();
     return true;
 }
 
@@ -100,6 +102,8 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid friendGuid, SocialFlag flag)
 
         CharacterDatabase.Execute(stmt);
     }
+
+    _updateIgnoreCount();
 }
 
 void PlayerSocial::SetFriendNote(ObjectGuid friendGuid, std::string note)
@@ -192,6 +196,9 @@ bool PlayerSocial::HasFriend(ObjectGuid friend_guid) const
 
 bool PlayerSocial::HasIgnore(ObjectGuid ignore_guid) const
 {
+    if (!m_ignoreCount)
+        return false;
+
     return _checkContact(ignore_guid, SOCIAL_FLAG_IGNORED);
 }
 
@@ -335,5 +342,6 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid guid)
         social->m_playerSocialMap[friendGuid] = FriendInfo(flags, note);
     } while (result->NextRow());
 
+    social->_updateIgnoreCount();
     return social;
 }
@@ -118,9 +118,11 @@ class PlayerSocial
         uint32 GetNumberOfSocialsWithFlag(SocialFlag flag) const;
     private:
         bool _checkContact(ObjectGuid guid, SocialFlag flags) const;
+        void _updateIgnoreCount() { m_ignoreCount = GetNumberOfSocialsWithFlag(SOCIAL_FLAG_IGNORED); }
         typedef std::map<ObjectGuid, FriendInfo> PlayerSocialMap;
         PlayerSocialMap m_playerSocialMap;
         ObjectGuid m_playerGUID;
+        uint32 m_ignoreCount;                               // lets HasIgnore skip the lookup for the many players ignoring nobody
 };
 
 class SocialMgr
@@ -169,6 +169,9 @@ void Player::ApplySpellPowerBonus(int32 amount, bool apply)
 
 void Player::UpdateSpellDamageAndHealingBonus()
 {
+    if (DeferStatUpdate(DEFERRED_STAT_UPDATE_SPELL_DAMAGE))
+        return;
+
     // Magic damage modifiers implemented in Unit::SpellDamageBonusDone
     // This information for client side use only
     // Get healing bonus for all schools
@@ -178,8 +181,119 @@ void Player::UpdateSpellDamageAndHealingBonus()
         SetStatInt32Value(PLAYER_FIELD_MOD_DAMAGE_DONE_POS + i, SpellBaseDamageBonusDone(SpellSchoolMask(1 << i)));
 }
 
+bool Player::DeferStatUpdate(DeferredStatUpdate update)
+{
+    if (m_runningStatUpdate == update)
+        return false;
+
+    // out of world nothing sends or reads the values between ticks, only batched changes are deferred
+    if (!m_flushingStatUpdates && !m_statUpdateBatchDepth && !IsInWorld())
+        return false;
+
+    m_deferredStatUpdates |= update;
+
+    // updates requested by a recalculation are merged into the running flush
+    if (!m_flushingStatUpdates)
+    {
+        m_hasDeferredValues = true;
+        AddToObjectUpdateIfNeeded();
+    }
+
+    return true;
+}
+
+void Player::EndStatUpdateBatch()
+{
+    ASSERT(m_statUpdateBatchDepth);
+    if (--m_statUpdateBatchDepth)
+        return;
+
+    // in world the values are recalculated when read or before Map::SendObjectUpdates
+    if (!IsInWorld())
+        FlushStatUpdates();
+}
+
+void Player::FlushStatUpdates()
+{
+    if (!m_deferredStatUpdates || m_flushingStatUpdates)
+        return;
+
+    m_flushingStatUpdates = true;
+    m_hasDeferredValues = false;
+
+    while (m_deferredStatUpdates)
+    {
+        uint32 update = m_deferredStatUpdates & (~m_deferredStatUpdates + 1);
+        m_deferredStatUpdates &= ~update;
+        m_runningStatUpdate = update;
+
+        switch (update)
+        {
+            case DEFERRED_STAT_UPDATE_ATTACK_POWER:
+                UpdateAttackPowerAndDamage(false);
+                break;
+            case DEFERRED_STAT_UPDATE_RANGED_ATTACK_POWER:
+                UpdateAttackPowerAndDamage(true);
+                break;
+            case DEFERRED_STAT_UPDATE_CRIT:
+                UpdateAllCritPercentages();
+                break;
+            case DEFERRED_STAT_UPDATE_DODGE:
+                UpdateDodgePercentage();
+                break;
+            case DEFERRED_STAT_UPDATE_SPELL_CRIT:
+                UpdateAllSpellCritChances();
+                break;
+            case DEFERRED_STAT_UPDATE_SHIELD_BLOCK:
+                UpdateShieldBlockValue();
+                break;
+            case DEFERRED_STAT_UPDATE_SPELL_DAMAGE:
+                UpdateSpellDamageAndHealingBonus();
+                break;
+            case DEFERRED_STAT_UPDATE_MANA_REGEN:
+                UpdateManaRegen();
+                break;
+            default:
+                break;
+        }
+    }
+
+    m_runningStatUpdate = 0;
+    m_flushingStatUpdates = false;
+}
+
+void Player::OnDeferredValueRead(uint16 index)
+{
+    bool deferred = false;
+    if (index >= UNIT_FIELD_MINDAMAGE && index <= UNIT_FIELD_MAXOFFHANDDAMAGE)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_ATTACK_POWER;
+    else if (index >= UNIT_FIELD_ATTACK_POWER && index <= UNIT_FIELD_ATTACK_POWER_MULTIPLIER)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_ATTACK_POWER;
+    else if (index >= UNIT_FIELD_RANGED_ATTACK_POWER && index <= UNIT_FIELD_MAXRANGEDDAMAGE)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_RANGED_ATTACK_POWER;
+    else if (index >= UNIT_FIELD_POWER_REGEN_FLAT_MODIFIER && index < UNIT_FIELD_POWER_REGEN_INTERRUPTED_FLAT_MODIFIER + MAX_POWERS)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_MANA_REGEN;
+    else if (index == PLAYER_DODGE_PERCENTAGE)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_DODGE;
+    else if (index == PLAYER_SHIELD_BLOCK)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_SHIELD_BLOCK;
+    else if (index >= PLAYER_SPELL_CRIT_PERCENTAGE1 && index < PLAYER_SPELL_CRIT_PERCENTAGE1 + MAX_SPELL_SCHOOL)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_SPELL_CRIT;
+    else if (index >= PLAYER_CRIT_PERCENTAGE && index <= PLAYER_OFFHAND_CRIT_PERCENTAGE)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_CRIT;
+    else if (index >= PLAYER_FIELD_MOD_DAMAGE_DONE_POS && index < PLAYER_FIELD_MOD_DAMAGE_DONE_POS + MAX_SPELL_SCHOOL)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_SPELL_DAMAGE;
+    else if (index == PLAYER_FIELD_MOD_HEALING_DONE_POS)
+        deferred = m_deferredStatUpdates & DEFERRED_STAT_UPDATE_SPELL_DAMAGE;
+
+    if (deferred)
+        FlushStatUpdates();
+}
+
 bool Player::UpdateAllStats()
 {
+    StatUpdateBatch batch(this);
+
     for (int8 i = STAT_STRENGTH; i < MAX_STATS; ++i)
     {
         float value = GetTotalStatValue(Stats(i));
@@ -322,6 +436,9 @@ void Player::ApplyFeralAPBonus(int32 amount, bool apply)
 
 void Player::UpdateAttackPowerAndDamage(bool ranged)
 {
+    if (DeferStatUpdate(ranged ? DEFERRED_STAT_UPDATE_RANGED_ATTACK_POWER : DEFERRED_STAT_UPDATE_ATTACK_POWER))
+        return;
+
     float val2 = 0.0f;
     float level = float(getLevel());
 
@@ -521,6 +638,9 @@ void Player::UpdateAttackPowerAndDamage(bool ranged)
 
 void Player::UpdateShieldBlockValue()
 {
+    if (DeferStatUpdate(DEFERRED_STAT_UPDATE_SHIELD_BLOCK))
+        return;
+
     SetUInt32Value(PLAYER_SHIELD_BLOCK, GetShieldBlockValue());
 }
 
@@ -652,6 +772,9 @@ void Player::UpdateCritPercentage(WeaponAttackType attType)
 
 void Player::UpdateAllCritPercentages()
 {
+    if (DeferStatUpdate(DEFERRED_STAT_UPDATE_CRIT))
+        return;
+
     float value = GetMeleeCritFromAgility();
 
     SetBaseModValue(CRIT_PERCENTAGE, PCT_MOD, value);
@@ -748,6 +871,9 @@ void Player::UpdateParryPercentage()
 
 void Player::UpdateDodgePercentage()
 {
+    if (DeferStatUpdate(DEFERRED_STAT_UPDATE_DODGE))
+        return;
+
     const float dodge_cap[MAX_CLASSES] =
     {
         88.129021f,     // Warrior
@@ -833,6 +959,9 @@ void Player::UpdateSpellHitChances()
 
 void Player::UpdateAllSpellCritChances()
 {
+    if (DeferStatUpdate(DEFERRED_STAT_UPDATE_SPELL_CRIT))
+        return;
+
     for (int i = SPELL_SCHOOL_NORMAL; i < MAX_SPELL_SCHOOL; ++i)
         UpdateSpellCritChance(i);
 }
@@ -886,6 +1015,9 @@ void Player::ApplyHealthRegenBonus(int32 amount, bool apply)
 
 void Player::UpdateManaRegen()
 {
+    if (DeferStatUpdate(DEFERRED_STAT_UPDATE_MANA_REGEN))
+        return;
+
     if( HasAuraTypeWithMiscvalue(SPELL_AURA_PREVENT_REGENERATE_POWER, POWER_MANA + 1) )
     {
         SetStatFloatValue(UNIT_FIELD_POWER_REGEN_INTERRUPTED_FLAT_MODIFIER, 0);
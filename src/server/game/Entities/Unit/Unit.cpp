@@ -824,9 +824,10 @@ uint32 Unit::DealDamage(Unit* attacker, Unit* victim, uint32 damage, CleanDamage
 
         // We're going to call functions which can modify content of the list during iteration over it's elements
         // Let's copy the list so we can prevent iterator invalidation
-        AuraEffectList vCopyDamageCopy(victim->GetAuraEffectsByType(SPELL_AURA_SHARE_DAMAGE_PCT));
+        AuraEffectList const& copyDamage = victim->GetAuraEffectsByType(SPELL_AURA_SHARE_DAMAGE_PCT);
+        std::vector<AuraEffect*> vCopyDamageCopy(copyDamage.begin(), copyDamage.end());
         // copy damage to casters of this aura
-        for (AuraEffectList::iterator i = vCopyDamageCopy.begin(); i != vCopyDamageCopy.end(); ++i)
+        for (std::vector<AuraEffect*>::iterator i = vCopyDamageCopy.begin(); i != vCopyDamageCopy.end(); ++i)
         {
             // Check if aura was removed during iteration - we don't need to work on such auras
             if (!((*i)->GetBase()->IsAppliedOnTarget(victim->GetGUID())))
@@ -1671,8 +1672,9 @@ void Unit::DealMeleeDamage(CalcDamageInfo* damageInfo, bool durabilityLoss)
     {
         // We're going to call functions which can modify content of the list during iteration over it's elements
         // Let's copy the list so we can prevent iterator invalidation
-        AuraEffectList vDamageShieldsCopy(victim->GetAuraEffectsByType(SPELL_AURA_DAMAGE_SHIELD));
-        for (AuraEffectList::const_iterator dmgShieldItr = vDamageShieldsCopy.begin(); dmgShieldItr != vDamageShieldsCopy.end(); ++dmgShieldItr)
+        AuraEffectList const& damageShields = victim->GetAuraEffectsByType(SPELL_AURA_DAMAGE_SHIELD);
+        std::vector<AuraEffect*> vDamageShieldsCopy(damageShields.begin(), damageShields.end());
+        for (std::vector<AuraEffect*>::const_iterator dmgShieldItr = vDamageShieldsCopy.begin(); dmgShieldItr != vDamageShieldsCopy.end(); ++dmgShieldItr)
         {
             SpellInfo const* i_spellProto = (*dmgShieldItr)->GetSpellInfo();
             // Damage shield can be resisted...
@@ -1971,11 +1973,12 @@ void Unit::CalcAbsorbResist(DamageInfo& dmgInfo, bool Splited)
 
     // We're going to call functions which can modify content of the list during iteration over it's elements
     // Let's copy the list so we can prevent iterator invalidation
-    AuraEffectList vSchoolAbsorbCopy(victim->GetAuraEffectsByType(SPELL_AURA_SCHOOL_ABSORB));
-    vSchoolAbsorbCopy.sort(Acore::AbsorbAuraOrderPred());
+    AuraEffectList const& schoolAbsorb = victim->GetAuraEffectsByType(SPELL_AURA_SCHOOL_ABSORB);
+    std::vector<AuraEffect*> vSchoolAbsorbCopy(schoolAbsorb.begin(), schoolAbsorb.end());
+    std::stable_sort(vSchoolAbsorbCopy.begin(), vSchoolAbsorbCopy.end(), Acore::AbsorbAuraOrderPred());
 
     // absorb without mana cost
-    for (AuraEffectList::iterator itr = vSchoolAbsorbCopy.begin(); (itr != vSchoolAbsorbCopy.end()) && (dmgInfo.GetDamage() > 0); ++itr)
+    for (std::vector<AuraEffect*>::iterator itr = vSchoolAbsorbCopy.begin(); (itr != vSchoolAbsorbCopy.end()) && (dmgInfo.GetDamage() > 0); ++itr)
     {
         AuraEffect* absorbAurEff = *itr;
         // Check if aura was removed during iteration - we don't need to work on such auras
@@ -2024,8 +2027,9 @@ void Unit::CalcAbsorbResist(DamageInfo& dmgInfo, bool Splited)
     }
 
     // absorb by mana cost
-    AuraEffectList vManaShieldCopy(victim->GetAuraEffectsByType(SPELL_AURA_MANA_SHIELD));
-    for (AuraEffectList::const_iterator itr = vManaShieldCopy.begin(); (itr != vManaShieldCopy.end()) && (dmgInfo.GetDamage() > 0); ++itr)
+    AuraEffectList const& manaShield = victim->GetAuraEffectsByType(SPELL_AURA_MANA_SHIELD);
+    std::vector<AuraEffect*> vManaShieldCopy(manaShield.begin(), manaShield.end());
+    for (std::vector<AuraEffect*>::const_iterator itr = vManaShieldCopy.begin(); (itr != vManaShieldCopy.end()) && (dmgInfo.GetDamage() > 0); ++itr)
     {
         AuraEffect* absorbAurEff = *itr;
         // Check if aura was removed during iteration - we don't need to work on such auras
@@ -2089,8 +2093,9 @@ void Unit::CalcAbsorbResist(DamageInfo& dmgInfo, bool Splited)
     {
         // We're going to call functions which can modify content of the list during iteration over it's elements
         // Let's copy the list so we can prevent iterator invalidation
-        AuraEffectList vSplitDamageFlatCopy(victim->GetAuraEffectsByType(SPELL_AURA_SPLIT_DAMAGE_FLAT));
-        for (AuraEffectList::iterator itr = vSplitDamageFlatCopy.begin(); (itr != vSplitDamageFlatCopy.end()) && (dmgInfo.GetDamage() > 0); ++itr)
+        AuraEffectList const& splitDamageFlat = victim->GetAuraEffectsByType(SPELL_AURA_SPLIT_DAMAGE_FLAT);
+        std::vector<AuraEffect*> vSplitDamageFlatCopy(splitDamageFlat.begin(), splitDamageFlat.end());
+        for (std::vector<AuraEffect*>::iterator itr = vSplitDamageFlatCopy.begin(); (itr != vSplitDamageFlatCopy.end()) && (dmgInfo.GetDamage() > 0); ++itr)
         {
             // Check if aura was removed during iteration - we don't need to work on such auras
             if (!((*itr)->GetBase()->IsAppliedOnTarget(victim->GetGUID())))
@@ -2145,8 +2150,9 @@ void Unit::CalcAbsorbResist(DamageInfo& dmgInfo, bool Splited)
 
         // We're going to call functions which can modify content of the list during iteration over it's elements
         // Let's copy the list so we can prevent iterator invalidation
-        AuraEffectList vSplitDamagePctCopy(victim->GetAuraEffectsByType(SPELL_AURA_SPLIT_DAMAGE_PCT));
-        for (AuraEffectList::iterator itr = vSplitDamagePctCopy.begin(), next; (itr != vSplitDamagePctCopy.end()) &&  (dmgInfo.GetDamage() > 0); ++itr)
+        AuraEffectList const& splitDamagePct = victim->GetAuraEffectsByType(SPELL_AURA_SPLIT_DAMAGE_PCT);
+        std::vector<AuraEffect*> vSplitDamagePctCopy(splitDamagePct.begin(), splitDamagePct.end());
+        for (std::vector<AuraEffect*>::iterator itr = vSplitDamagePctCopy.begin(), next; (itr != vSplitDamagePctCopy.end()) &&  (dmgInfo.GetDamage() > 0); ++itr)
         {
             // Check if aura was removed during iteration - we don't need to work on such auras
             AuraApplication const* aurApp = (*itr)->GetBase()->GetApplicationOfTarget(victim->GetGUID());
@@ -3393,6 +3399,11 @@ void Unit::_DeleteRemovedAuras()
         delete m_removedAuras.front();
         m_removedAuras.pop_front();
     }
+
+    for (AuraType auraType : m_modAurasToCompact)
+        m_modAuras[auraType].compact();
+
+    m_modAurasToCompact.clear();
 }
 
 void Unit::_UpdateSpells(uint32 time)
@@ -4213,10 +4224,17 @@ void Unit::_RemoveNoStackAurasDueToAura(Aura* aura)
 
 void Unit::_RegisterAuraEffect(AuraEffect* aurEff, bool apply)
 {
+    AuraEffectList& effects = m_modAuras[aurEff->GetAuraType()];
     if (apply)
-        m_modAuras[aurEff->GetAuraType()].push_back(aurEff);
+        effects.push_back(aurEff);
     else
-        m_modAuras[aurEff->GetAuraType()].remove(aurEff);
+    {
+        bool hadHoles = effects.NeedsCompaction();
+        effects.remove(aurEff);
+        // iterators of this list may still be in use, holes are reclaimed in _DeleteRemovedAuras
+        if (!hadHoles && effects.NeedsCompaction())
+            m_modAurasToCompact.push_back(aurEff->GetAuraType());
+    }
 }
 
 // All aura base removes should go threw this function!
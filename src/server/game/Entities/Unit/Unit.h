@@ -25,6 +25,7 @@
 #include "MotionMaster.h"
 #include "Object.h"
 #include "SpellAuraDefines.h"
+#include "StablePtrVector.h"
 #include "ThreatMgr.h"
 #include <functional>
 
@@ -1432,7 +1433,7 @@ public:
     typedef std::multimap<AuraStateType,  AuraApplication*> AuraStateAurasMap;
     typedef std::pair<AuraStateAurasMap::const_iterator, AuraStateAurasMap::const_iterator> AuraStateAurasMapBounds;
 
-    typedef std::list<AuraEffect*> AuraEffectList;
+    typedef Acore::StablePtrVector<AuraEffect> AuraEffectList;
     typedef std::list<Aura*> AuraList;
     typedef std::list<AuraApplication*> AuraApplicationList;
     typedef std::list<DiminishingReturn> Diminishing;
@@ -2570,6 +2571,7 @@ protected:
     uint32 m_removedAurasCount;
 
     AuraEffectList m_modAuras[TOTAL_AURAS];
+    std::vector<AuraType> m_modAurasToCompact; // aura types whose effect list has holes left by removals
     AuraList m_scAuras;                        // casted singlecast auras
     AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
     AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
@@ -44,6 +44,7 @@ void HashMapHolder<T>::Insert(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer()[o->GetGUID()] = o;
+    GetLookupTable().Insert(o->GetGUID().GetRawValue(), o);
 }
 
 template<class T>
@@ -52,15 +53,16 @@ void HashMapHolder<T>::Remove(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer().erase(o->GetGUID());
+    GetLookupTable().Erase(o->GetGUID().GetRawValue());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
+    if (!guid)
+        return nullptr;
 
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    return GetLookupTable().Find(guid.GetRawValue());
 }
 
 template<class T>
@@ -70,6 +72,13 @@ auto HashMapHolder<T>::GetContainer() -> MapType&
     return _objectMap;
 }
 
+template<class T>
+auto HashMapHolder<T>::GetLookupTable() -> LookupTableType&
+{
+    static LookupTableType _lookupTable;
+    return _lookupTable;
+}
+
 template<class T>
 std::shared_mutex* HashMapHolder<T>::GetLock()
 {
@@ -85,19 +94,111 @@ HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
 template class HashMapHolder<Player>;
 template class HashMapHolder<MotionTransport>;
 
+// players by normalized name, keyed by the name hash so lookups are lock free like HashMapHolder::Find.
+// Slots point to an immutable copy of the name, a lookup compares it without touching the player.
+// A player whose name hash is already taken by another name is kept in a locked map instead.
 namespace PlayerNameMapHolder
 {
-    typedef std::unordered_map<std::string, Player*> MapType;
-    static MapType PlayerNameMap;
+    struct NameEntry
+    {
+        std::string Name;
+        Player* Owner;
+    };
+
+    static Acore::LockFreeLookupTable<NameEntry const> PlayerNameMap;
+    static std::unordered_map<uint64, std::unique_ptr<NameEntry const>> NameEntries;     // owns the entries in PlayerNameMap
+    static std::vector<std::pair<uint64, std::unique_ptr<NameEntry const>>> RetiredNameEntries; // by retire epoch
+    static std::unordered_map<std::string, Player*> CollidingNames;
+    static std::atomic<bool> HasCollidingNames(false);
+    static std::mutex PlayerNameMapLock;
+
+    uint64 GetNameKey(std::string const& name)
+    {
+        uint64 key = std::hash<std::string>()(name);
+        return (key == 0 || key == ~uint64(0)) ? 1 : key; // reserved keys of the table
+    }
+
+    // writer side, PlayerNameMapLock held
+    void SetEntry(uint64 key, std::string const& name, Player* p)
+    {
+        std::unique_ptr<NameEntry const>& entry = NameEntries[key];
+        std::unique_ptr<NameEntry const> oldEntry = std::move(entry);
+
+        if (p)
+        {
+            entry = std::make_unique<NameEntry const>(NameEntry{ name, p });
+            PlayerNameMap.Insert(key, entry.get());
+        }
+        else
+        {
+            NameEntries.erase(key);
+            PlayerNameMap.Erase(key);
+        }
+
+        // lookups that started before may still read the old entry
+        RetiredNameEntries.erase(std::remove_if(RetiredNameEntries.begin(), RetiredNameEntries.end(), [](auto const& retired)
+        {
+            return Acore::LookupTableEpoch::IsQuiescent(retired.first);
+        }), RetiredNameEntries.end());
+
+        if (oldEntry)
+            RetiredNameEntries.emplace_back(Acore::LookupTableEpoch::Retire(), std::move(oldEntry));
+    }
+
+    Player* FindInTable(uint64 key, std::string const& name)
+    {
+        Acore::LookupTableEpoch::ReadGuard guard;
+
+        NameEntry const* entry = PlayerNameMap.Find(key);
+        return (entry && entry->Name == name) ? entry->Owner : nullptr;
+    }
 
     void Insert(Player* p)
     {
-        PlayerNameMap[p->GetName()] = p;
+        std::lock_guard<std::mutex> lock(PlayerNameMapLock);
+
+        uint64 key = GetNameKey(p->GetName());
+        auto itr = NameEntries.find(key);
+        if (itr != NameEntries.end() && itr->second->Name != p->GetName())
+        {
+            CollidingNames[p->GetName()] = p;
+            HasCollidingNames.store(true, std::memory_order_release);
+            return;
+        }
+
+        SetEntry(key, p->GetName(), p);
     }
 
     void Remove(Player* p)
     {
-        PlayerNameMap.erase(p->GetName());
+        std::lock_guard<std::mutex> lock(PlayerNameMapLock);
+
+        auto collidingItr = CollidingNames.find(p->GetName());
+        if (collidingItr != CollidingNames.end() && collidingItr->second == p)
+        {
+            CollidingNames.erase(collidingItr);
+            HasCollidingNames.store(!CollidingNames.empty(), std::memory_order_release);
+            return;
+        }
+
+        uint64 key = GetNameKey(p->GetName());
+        auto itr = NameEntries.find(key);
+        if (itr == NameEntries.end() || itr->second->Owner != p)
+            return;
+
+        // a colliding player takes over the freed slot
+        for (collidingItr = CollidingNames.begin(); collidingItr != CollidingNames.end(); ++collidingItr)
+        {
+            if (GetNameKey(collidingItr->first) == key)
+            {
+                SetEntry(key, collidingItr->first, collidingItr->second);
+                CollidingNames.erase(collidingItr);
+                HasCollidingNames.store(!CollidingNames.empty(), std::memory_order_release);
+                return;
+            }
+        }
+
+        SetEntry(key, std::string(), nullptr);
     }
 
     Player* Find(std::string const& name)
@@ -106,8 +207,20 @@ namespace PlayerNameMapHolder
         if (!normalizePlayerName(charName))
             return nullptr;
 
-        auto itr = PlayerNameMap.find(charName);
-        return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
+        uint64 key = GetNameKey(charName);
+        if (Player* player = FindInTable(key, charName))
+            return player;
+
+        if (!HasCollidingNames.load(std::memory_order_acquire))
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(PlayerNameMapLock);
+        auto itr = CollidingNames.find(charName);
+        if (itr != CollidingNames.end())
+            return itr->second;
+
+        // it may have moved into the table while we waited for the lock
+        return FindInTable(key, charName);
     }
 
 } // namespace PlayerNameMapHolder
@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "GridDefines.h"
+#include "LockFreeLookupTable.h"
 #include "Object.h"
 #include "UpdateData.h"
 #include <mutex>
@@ -50,15 +51,22 @@ public:
 
     typedef std::unordered_map<ObjectGuid, T*> MapType;
 
+    typedef Acore::LockFreeLookupTable<T> LookupTableType;
+
     static void Insert(T* o);
 
     static void Remove(T* o);
 
+    // lock free, does not need GetLock()
     static T* Find(ObjectGuid guid);
 
     static MapType& GetContainer();
 
     static std::shared_mutex* GetLock();
+
+private:
+    // written under GetLock(), read without it
+    static LookupTableType& GetLookupTable();
 };
 
 namespace ObjectAccessor
@@ -32,6 +32,7 @@
 #include "Language.h"
 #include "Log.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "ReputationMgr.h"
@@ -5671,125 +5672,161 @@ void ObjectMgr::LoadNpcTextLocales()
 
 void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
-    uint32 oldMSTime = getMSTime();
+    // the previous pass is still working through its batches
+    if (_expiredMailPass.Running)
+    {
+        LOG_DEBUG("server", "ObjectMgr::ReturnOrDeleteOldMails: previous pass still running at mail %u", _expiredMailPass.LastMailId);
+        return;
+    }
 
-    time_t curTime = time(nullptr);
+    _expiredMailPass = ExpiredMailPass();
+    _expiredMailPass.Running = true;
+    _expiredMailPass.ExpireTime = uint32(time(nullptr));
+    _expiredMailPass.StartMSTime = getMSTime();
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
-    stmt->setUInt32(0, uint32(curTime));
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-    if (!result)
+    // while the server is up batches are queried asynchronously and handled one per world update
+    if (serverUp)
+    {
+        QueueExpiredMailBatch();
         return;
+    }
+
+    while (PreparedQueryResult result = CharacterDatabase.Query(GetExpiredMailBatchStatement()))
+        if (ProcessExpiredMailBatch(result, false) < sWorld->getIntConfig(CONFIG_MAIL_EXPIRY_BATCH_SIZE))
+            break;
+
+    FinishExpiredMailPass();
+}
 
-    std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
-    stmt->setUInt32(0, uint32(curTime));
-    if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
+void ObjectMgr::UpdateExpiredMails()
+{
+    _expiredMailQueryProcessor.ProcessReadyCallbacks();
+}
+
+CharacterDatabasePreparedStatement* ObjectMgr::GetExpiredMailBatchStatement() const
+{
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
+    stmt->setUInt32(0, _expiredMailPass.LastMailId);
+    stmt->setUInt32(1, _expiredMailPass.ExpireTime);
+    stmt->setUInt32(2, sWorld->getIntConfig(CONFIG_MAIL_EXPIRY_BATCH_SIZE));
+    return stmt;
+}
+
+void ObjectMgr::QueueExpiredMailBatch()
+{
+    _expiredMailQueryProcessor.AddCallback(CharacterDatabase.AsyncQuery(GetExpiredMailBatchStatement()).WithPreparedCallback([this](PreparedQueryResult result)
     {
-        MailItemInfo item;
-        do
+        if (result && ProcessExpiredMailBatch(result, true) >= sWorld->getIntConfig(CONFIG_MAIL_EXPIRY_BATCH_SIZE))
         {
-            Field* fields = items->Fetch();
-            item.item_guid = fields[0].GetUInt32();
-            item.item_template = fields[1].GetUInt32();
-            uint32 mailId = fields[2].GetUInt32();
-            itemsCache[mailId].push_back(item);
-        } while (items->NextRow());
-    }
+            QueueExpiredMailBatch();
+            return;
+        }
 
-    uint32 deletedCount = 0;
-    uint32 returnedCount = 0;
+        FinishExpiredMailPass();
+    }));
+}
+
+uint32 ObjectMgr::ProcessExpiredMailBatch(PreparedQueryResult result, bool serverUp)
+{
+    time_t curTime = time(nullptr);
+    uint32 count = 0;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     do
     {
         Field* fields = result->Fetch();
-        Mail* m = new Mail;
-        m->messageID      = fields[0].GetUInt32();
-        m->messageType    = fields[1].GetUInt8();
-        m->sender         = fields[2].GetUInt32();
-        m->receiver       = fields[3].GetUInt32();
-        bool has_items    = fields[4].GetBool();
-        m->expire_time    = time_t(fields[5].GetUInt32());
-        m->deliver_time   = time_t(0);
-        m->stationery     = fields[6].GetUInt8();
-        m->checked        = fields[7].GetUInt8();
-        m->mailTemplateId = fields[8].GetInt16();
-        m->auctionId      = fields[9].GetInt32();
-
-        Player* player = nullptr;
-        if (serverUp)
-            player = ObjectAccessor::FindPlayerByLowGUID(m->receiver);
-
-        if (player) // don't modify mails of a logged in player
-        {
-            delete m;
+        Mail m;
+        m.messageID      = fields[0].GetUInt32();
+        m.messageType    = fields[1].GetUInt8();
+        m.sender         = fields[2].GetUInt32();
+        m.receiver       = fields[3].GetUInt32();
+        bool has_items   = fields[4].GetBool();
+        m.expire_time    = time_t(fields[5].GetUInt32());
+        m.deliver_time   = time_t(0);
+        m.stationery     = fields[6].GetUInt8();
+        m.checked        = fields[7].GetUInt8();
+        m.mailTemplateId = fields[8].GetInt16();
+        m.auctionId      = fields[9].GetInt32();
+
+        ++count;
+        _expiredMailPass.LastMailId = m.messageID;
+
+        // don't modify mails of a logged in player
+        if (serverUp && ObjectAccessor::FindPlayerByLowGUID(m.receiver))
+        {
+            ++_expiredMailPass.Skipped;
             continue;
         }
 
         // Delete or return mail
+        CharacterDatabasePreparedStatement* stmt = nullptr;
         if (has_items)
         {
-            // read items from cache
-            m->items.swap(itemsCache[m->messageID]);
-
             // If it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
-            if (!m->IsSentByPlayer() || m->IsSentByGM() || (m->IsCODPayment() || m->IsReturnedMail()))
+            if (!m.IsSentByPlayer() || m.IsSentByGM() || (m.IsCODPayment() || m.IsReturnedMail()))
             {
-                for (auto const& mailedItem : m->items)
-                {
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
-                    stmt->setUInt32(0, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
-                }
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_MAIL_ITEM_INSTANCES);
+                stmt->setUInt32(0, m.messageID);
+                trans->Append(stmt);
 
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
-                stmt->setUInt32(0, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                stmt->setUInt32(0, m.messageID);
+                trans->Append(stmt);
             }
             else
             {
                 // Mail will be returned
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
-                stmt->setUInt32(0, m->receiver);
-                stmt->setUInt32(1, m->sender);
+                stmt->setUInt32(0, m.receiver);
+                stmt->setUInt32(1, m.sender);
                 stmt->setUInt32(2, uint32(curTime + 30 * DAY));
                 stmt->setUInt32(3, uint32(curTime));
                 stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
-                stmt->setUInt32(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
-                for (auto const& mailedItem : m->items)
-                {
-                    // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
-
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
-                }
+                stmt->setUInt32(5, m.messageID);
+                trans->Append(stmt);
+
+                // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_RETURNED_MAIL_ITEMS);
+                stmt->setUInt32(0, m.sender);
+                stmt->setUInt32(1, m.sender);
+                stmt->setUInt32(2, m.messageID);
+                trans->Append(stmt);
 
                 // xinef: update global data
-                sCharacterCache->IncreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->sender));
-                sCharacterCache->DecreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->receiver));
+                sCharacterCache->IncreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m.sender));
+                sCharacterCache->DecreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m.receiver));
 
-                delete m;
-                ++returnedCount;
+                ++_expiredMailPass.Returned;
                 continue;
             }
         }
 
-        sCharacterCache->DecreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->receiver));
+        sCharacterCache->DecreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m.receiver));
 
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
-        stmt->setUInt32(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
-        delete m;
-        ++deletedCount;
+        stmt->setUInt32(0, m.messageID);
+        trans->Append(stmt);
+        ++_expiredMailPass.Deleted;
     } while (result->NextRow());
 
-    LOG_INFO("server.loading", ">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+    CharacterDatabase.CommitTransaction(trans);
+
+    METRIC_VALUE("expired_mails_processed", uint64(_expiredMailPass.Deleted + _expiredMailPass.Returned + _expiredMailPass.Skipped));
+
+    return count;
+}
+
+void ObjectMgr::FinishExpiredMailPass()
+{
+    _expiredMailPass.Running = false;
+
+    uint32 duration = GetMSTimeDiffToNow(_expiredMailPass.StartMSTime);
+    METRIC_VALUE("expired_mails", uint64(_expiredMailPass.Deleted), METRIC_TAG("type", "deleted"));
+    METRIC_VALUE("expired_mails", uint64(_expiredMailPass.Returned), METRIC_TAG("type", "returned"));
+    METRIC_VALUE("expired_mails", uint64(_expiredMailPass.Skipped), METRIC_TAG("type", "skipped"));
+    METRIC_VALUE("expired_mails_pass_time", uint64(duration));
+
+    LOG_INFO("server.loading", ">> Processed %u expired mails: %u deleted and %u returned in %u ms", _expiredMailPass.Deleted + _expiredMailPass.Returned, _expiredMailPass.Deleted, _expiredMailPass.Returned, duration);
     LOG_INFO("server.loading", " ");
 }
 
@@ -18,6 +18,7 @@
 #ifndef _OBJECTMGR_H
 #define _OBJECTMGR_H
 
+#include "AsyncCallbackProcessor.h"
 #include "Bag.h"
 #include "ConditionMgr.h"
 #include "Corpse.h"
@@ -1068,6 +1069,7 @@ public:
     }
 
     void ReturnOrDeleteOldMails(bool serverUp);
+    void UpdateExpiredMails();
 
     CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
 
@@ -1377,6 +1379,26 @@ private:
     uint64 _equipmentSetGuid; // pussywizard: accessed by a single thread
     uint32 _mailId;
     std::mutex _mailIdMutex;
+
+    // expired mails are walked in id order, one batch per query
+    struct ExpiredMailPass
+    {
+        bool Running = false;
+        uint32 LastMailId = 0;
+        uint32 ExpireTime = 0;
+        uint32 StartMSTime = 0;
+        uint32 Deleted = 0;
+        uint32 Returned = 0;
+        uint32 Skipped = 0;
+    };
+
+    ExpiredMailPass _expiredMailPass;
+    QueryCallbackProcessor _expiredMailQueryProcessor;
+
+    CharacterDatabasePreparedStatement* GetExpiredMailBatchStatement() const;
+    void QueueExpiredMailBatch();
+    uint32 ProcessExpiredMailBatch(PreparedQueryResult result, bool serverUp);
+    void FinishExpiredMailPass();
     uint32 _hiPetNumber;
     std::mutex _hiPetNumberMutex;
 
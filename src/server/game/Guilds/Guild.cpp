@@ -2134,26 +2134,30 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
     {
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), nullptr, msg);
+        std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(std::move(data));
         for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
             if (Player* player = itr->second->FindPlayer())
                 if (_HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) && !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()))
-                    player->GetSession()->SendPacket(&data);
+                    player->GetSession()->SendPacket(packet);
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket* packet, uint8 rankId) const
 {
+    std::shared_ptr<WorldPacket const> sharedPacket = std::make_shared<WorldPacket const>(*packet);
     for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
         if (itr->second->IsRank(rankId))
             if (Player* player = itr->second->FindPlayer())
-                player->GetSession()->SendPacket(packet);
+                player->GetSession()->SendPacket(sharedPacket);
 }
 
 void Guild::BroadcastPacket(WorldPacket* packet) const
 {
+    // one copy shared by every online member's socket instead of one per member
+    std::shared_ptr<WorldPacket const> sharedPacket = std::make_shared<WorldPacket const>(*packet);
     for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
         if (Player* player = itr->second->FindPlayer())
-            player->GetSession()->SendPacket(packet);
+            player->GetSession()->SendPacket(sharedPacket);
 }
 
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
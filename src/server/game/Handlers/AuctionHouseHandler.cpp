@@ -477,6 +477,7 @@ void WorldSession::HandleAuctionPlaceBid(WorldPacket& recvData)
 
         auction->bidder = player->GetGUID();
         auction->bid = price;
+        auctionHouse->MarkChanged(auction);
         GetPlayer()->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_AUCTION_BID, price);
 
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_AUCTION_BID);
@@ -743,12 +744,21 @@ void WorldSession::HandleAuctionListItems(WorldPacket& recvData)
         sortOrder.push_back(std::move(sortInfo));
     }
 
+    Creature* creature = GetPlayer()->GetNPCIfCanInteractWith(guid, UNIT_NPC_FLAG_AUCTIONEER);
+    if (!creature)
+    {
+        LOG_DEBUG("network", "WORLD: HandleAuctionListItems - Unit (%s) not found or you can't interact with him.", guid.ToString().c_str());
+        return;
+    }
+
     // remove fake death
     if (_player->HasUnitState(UNIT_STATE_DIED))
     {
         _player->RemoveAurasByType(SPELL_AURA_FEIGN_DEATH);
     }
 
+    AuctionHouseObject* auctionHouse = sAuctionMgr->GetAuctionsMap(creature->GetFaction());
+
     // pussywizard:
     const uint32 delay = 2000;
     const uint32 now = World::GetGameTimeMS();
@@ -759,7 +769,7 @@ void WorldSession::HandleAuctionListItems(WorldPacket& recvData)
     }
     _lastAuctionListItemsMSTime = now + delay - diff;
     std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetTempLock());
-    AsyncAuctionListingMgr::GetTempList().push_back(AuctionListItemsDelayEvent(delay - diff, _player->GetGUID(), guid, searchedname, listfrom, levelmin, levelmax, usable, auctionSlotID,
+    AsyncAuctionListingMgr::GetTempList().push_back(AuctionListItemsDelayEvent(delay - diff, _player->GetGUID(), guid, auctionHouse, GetSessionDbLocaleIndex(), GetSessionDbcLocale(), searchedname, listfrom, levelmin, levelmax, usable, auctionSlotID,
         auctionMainCategory, auctionSubCategory, quality, getAll, sortOrder));
 }
 
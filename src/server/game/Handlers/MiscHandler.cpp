@@ -284,20 +284,20 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
     data << uint32(matchCount);         // placeholder, count of players matching criteria
     data << uint32(displaycount);       // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList())
+    auto processTarget = [&](WhoListPlayerInfo const& target)
     {
         if (AccountMgr::IsPlayerAccount(security))
         {
             // player can see member of other team only if CONFIG_ALLOW_TWO_SIDE_WHO_LIST
             if (target.GetTeamId() != team && !allowTwoSideWhoList)
             {
-                continue;
+                return;
             }
 
             // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
             if (target.GetSecurity() > AccountTypes(gmLevelInWhoList))
             {
-                continue;
+                return;
             }
         }
 
@@ -305,60 +305,43 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
         if ((_player->GetGUID() != target.GetGuid() && !target.IsVisible()) &&
             (AccountMgr::IsPlayerAccount(_player->GetSession()->GetSecurity()) || target.GetSecurity() > _player->GetSession()->GetSecurity()))
         {
-            continue;
+            return;
         }
 
         // check if target's level is in level range
         uint8 lvl = target.GetLevel();
         if (lvl < levelMin || lvl > levelMax)
         {
-            continue;
+            return;
         }
 
         // check if class matches classmask
         uint8 class_ = target.GetClass();
         if (!(classmask & (1 << class_)))
         {
-            continue;
+            return;
         }
 
         // check if race matches racemask
         uint32 race = target.GetRace();
         if (!(racemask & (1 << race)))
         {
-            continue;
+            return;
         }
 
         uint32 playerZoneId = target.GetZoneId();
         uint8 gender = target.GetGender();
 
-        bool showZones = true;
-        for (uint32 i = 0; i < zonesCount; ++i)
-        {
-            if (zoneids[i] == playerZoneId)
-            {
-                showZones = true;
-                break;
-            }
-
-            showZones = false;
-        }
-
-        if (!showZones)
-        {
-            continue;
-        }
-
         std::wstring const& wideplayername = target.GetWidePlayerName();
         if (!(wpacketPlayerName.empty() || wideplayername.find(wpacketPlayerName) != std::wstring::npos))
         {
-            continue;
+            return;
         }
 
         std::wstring const& wideguildname = target.GetWideGuildName();
         if (!(wpacketGuildName.empty() || wideguildname.find(wpacketGuildName) != std::wstring::npos))
         {
-            continue;
+            return;
         }
 
         std::string aname;
@@ -386,14 +369,14 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
 
         if (!s_show)
         {
-            continue;
+            return;
         }
 
         // 49 is maximum player count sent to client - can be overridden
         // through config, but is unstable
         if ((matchCount++) >= sWorld->getIntConfig(CONFIG_MAX_WHO_LIST_RETURN))
         {
-            continue;
+            return;
         }
 
         data << target.GetPlayerName();                   // player name
@@ -405,6 +388,62 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
         data << uint32(playerZoneId);                     // player zone id
 
         ++displaycount;
+    };
+
+    // Walk the smallest set of candidates the indexes give, processTarget checks every filter anyway.
+    // Candidates are visited in storage order, so the entries kept by the result cap do not depend on the index used
+    WhoListCacheMgr const* whoList = sWhoListCacheMgr;
+    WhoListIndexVector const* candidates = nullptr;
+    WhoListIndexVector const* guildCandidates = nullptr;
+
+    whoList->GetPlayerNameCandidates(wpacketPlayerName, candidates);
+    if (whoList->GetGuildNameCandidates(wpacketGuildName, guildCandidates) && (!candidates || guildCandidates->size() < candidates->size()))
+        candidates = guildCandidates;
+
+    WhoListIndexVector positions;
+    if (zonesCount)
+    {
+        // each zone once
+        std::sort(zoneids.begin(), zoneids.begin() + zonesCount);
+        auto zonesEnd = std::unique(zoneids.begin(), zoneids.begin() + zonesCount);
+
+        std::size_t zoneCount = 0;
+        for (auto zoneItr = zoneids.begin(); zoneItr != zonesEnd; ++zoneItr)
+            if (WhoListIndexVector const* entries = whoList->GetZoneEntries(*zoneItr))
+                zoneCount += entries->size();
+
+        if (!candidates || zoneCount < candidates->size())
+        {
+            for (auto zoneItr = zoneids.begin(); zoneItr != zonesEnd; ++zoneItr)
+                if (WhoListIndexVector const* entries = whoList->GetZoneEntries(*zoneItr))
+                    positions.insert(positions.end(), entries->begin(), entries->end());
+
+            std::sort(positions.begin(), positions.end());
+            candidates = &positions;
+        }
+    }
+
+    if (!candidates && levelMin <= levelMax)
+    {
+        // a range covering most players is cheaper to walk in full than to collect and sort
+        std::size_t levelCount = whoList->GetLevelRangeCount(levelMin, levelMax);
+        if (levelCount * 2 < whoList->GetWhoList().size())
+        {
+            whoList->AppendLevelRangeEntries(levelMin, levelMax, positions);
+            std::sort(positions.begin(), positions.end());
+            candidates = &positions;
+        }
+    }
+
+    if (candidates)
+    {
+        for (uint32 position : *candidates)
+            processTarget(whoList->GetWhoList()[position]);
+    }
+    else
+    {
+        for (WhoListPlayerInfo const& target : whoList->GetWhoList())
+            processTarget(target);
     }
 
     data.put(0, displaycount);                            // insert right count, count displayed
@@ -869,6 +869,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     HandleDelayedVisibility();
 
+    _pathRequests.Update(this, sWorld->getIntConfig(CONFIG_MAP_PATH_REQUESTS_PER_UPDATE));
+
     sScriptMgr->OnMapUpdate(this, t_diff);
 
     METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
@@ -878,6 +880,21 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_path_requests_pending", uint64(_pathRequests.GetPendingCount()),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (_pathRequests.GetLastSolvedCount())
+    {
+        METRIC_VALUE("map_path_requests_solved", uint64(_pathRequests.GetLastSolvedCount()),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_path_request_latency", uint64(_pathRequests.GetLastMaxLatency().count()),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
 }
 
 void Map::HandleDelayedVisibility()
@@ -2574,7 +2591,11 @@ void Map::SendObjectUpdates()
         Object* obj = *_updateObjects.begin();
         ASSERT(obj->IsInWorld());
 
-        _updateObjects.erase(_updateObjects.begin());
+        // may queue more objects, erase by value
+        if (obj->HasDeferredValues())
+            obj->UpdateDeferredValues();
+
+        _updateObjects.erase(obj);
         obj->BuildUpdate(update_players, player_set);
     }
 
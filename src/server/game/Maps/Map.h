@@ -30,6 +30,7 @@
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
 #include "PathGenerator.h"
+#include "PathRequestQueue.h"
 #include "SharedDefines.h"
 #include "Timer.h"
 #include <bitset>
@@ -546,6 +547,7 @@ public:
     void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
     [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _dynamicTree; }
+    PathRequestQueue& GetPathRequestQueue() { return _pathRequests; }
     bool GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
     [[nodiscard]] float GetGameObjectFloor(uint32 phasemask, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
     {
@@ -682,6 +684,7 @@ protected:
     uint32 m_unloadTimer;
     float m_VisibleDistance;
     DynamicMapTree _dynamicTree;
+    PathRequestQueue _pathRequests;
     time_t _instanceResetPeriod; // pussywizard
 
     MapRefMgr m_mapRefMgr;
@@ -102,6 +102,17 @@ void MapUpdater::deactivate()
 
 void MapUpdater::wait()
 {
+    // take part in the update instead of idling until the workers drain the queue
+    UpdateRequest* request = nullptr;
+    while (_queue.Pop(request))
+    {
+        request->call();
+        delete request;
+    }
+
+    // only requests already running on workers are left, this is the critical path of the map update
+    METRIC_TIMER("world_update_critical_path", METRIC_TAG("phase", "Wait for maps"));
+
     std::unique_lock<std::mutex> guard(_lock);
 
     while (pending_requests > 0)
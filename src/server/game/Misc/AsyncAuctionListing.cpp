@@ -21,14 +21,19 @@
 #include "Opcodes.h"
 #include "Player.h"
 #include "SpellAuraEffects.h"
+#include "World.h"
 #include "WorldSession.h"
 
-uint32 AsyncAuctionListingMgr::auctionListingDiff = 0;
-bool AsyncAuctionListingMgr::auctionListingAllowed = false;
+std::atomic<uint32> AsyncAuctionListingMgr::auctionListingDiff(0);
+std::atomic<bool> AsyncAuctionListingMgr::auctionListingAllowed(false);
 std::list<AuctionListItemsDelayEvent> AsyncAuctionListingMgr::auctionListingList;
 std::list<AuctionListItemsDelayEvent> AsyncAuctionListingMgr::auctionListingListTemp;
 std::mutex AsyncAuctionListingMgr::auctionListingLock;
 std::mutex AsyncAuctionListingMgr::auctionListingTempLock;
+std::unordered_map<AuctionHouseObject*, AsyncAuctionListingMgr::SnapshotInfo> AsyncAuctionListingMgr::auctionSnapshots;
+std::mutex AsyncAuctionListingMgr::auctionSnapshotsLock;
+std::vector<AsyncAuctionListingMgr::Reply> AsyncAuctionListingMgr::auctionListingReplies;
+std::mutex AsyncAuctionListingMgr::auctionListingRepliesLock;
 
 bool AuctionListOwnerItemsDelayEvent::Execute(uint64  /*e_time*/, uint32  /*p_time*/)
 {
@@ -39,40 +44,141 @@ bool AuctionListOwnerItemsDelayEvent::Execute(uint64  /*e_time*/, uint32  /*p_ti
 
 bool AuctionListItemsDelayEvent::Execute()
 {
-    Player* plr = ObjectAccessor::FindPlayer(_playerguid);
-    if (!plr || !plr->IsInWorld() || plr->IsDuringRemoveFromWorld() || plr->IsBeingTeleported())
-        return true;
+    AuctionHouseSnapshotPtr snapshot = AsyncAuctionListingMgr::GetSnapshot(_auctionHouse);
+    if (!snapshot)
+        return false;
 
-    Creature* creature = plr->GetNPCIfCanInteractWith(_creatureguid, UNIT_NPC_FLAG_AUCTIONEER);
-    if (!creature)
+    // converting string that we try to find to lower case
+    AuctionListingQuery query;
+    if (!Utf8toWStr(_searchedname, query.SearchedName))
         return true;
 
-    AuctionHouseObject* auctionHouse = sAuctionMgr->GetAuctionsMap(creature->GetFaction());
+    wstrToLower(query.SearchedName);
+    query.ListFrom = _listfrom;
+    query.LevelMin = _levelmin;
+    query.LevelMax = _levelmax;
+    query.InventoryType = _auctionSlotID;
+    query.ItemClass = _auctionMainCategory;
+    query.ItemSubClass = _auctionSubCategory;
+    query.Quality = _quality;
+    query.Usable = _usable != 0;
+    query.SortOrder = _sortOrder;
+    query.DbLocale = _dbLocale;
+    query.DbcLocale = _dbcLocale;
+
+    std::vector<AuctionHouseSnapshot::Entry const*> entries;
+    snapshot->Search(query, entries);
+
+    if (_usable)
+    {
+        // the player must not be removed while we look at him
+        std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetLock());
+
+        Player* plr = ObjectAccessor::FindPlayer(_playerguid);
+        if (!plr || !plr->IsInWorld() || plr->IsDuringRemoveFromWorld() || plr->IsBeingTeleported())
+            return true;
+
+        // same checks as Player::CanUseItem(Item*), the bound item check is done on the snapshot
+        if (!plr->IsAlive())
+            entries.clear();
+
+        AuctionHouseSnapshot::FilterUsable(entries, plr->GetGUID(), [plr](ItemTemplate const* proto)
+        {
+            if (plr->CanUseItemInstanceOf(proto) != EQUIP_ERR_OK)
+                return false;
+
+            // xinef: check already learded recipes and pets
+            return proto->Spells[1].SpellTrigger != ITEM_SPELLTRIGGER_LEARN_SPELL_ID || !plr->HasSpell(proto->Spells[1].SpellId);
+        });
+    }
 
     WorldPacket data(SMSG_AUCTION_LIST_RESULT, (4 + 4 + 4) + 50 * ((16 + MAX_INSPECTED_ENCHANTMENT_SLOT * 3) * 4));
     uint32 count = 0;
     uint32 totalcount = 0;
     data << (uint32) 0;
 
-    // converting string that we try to find to lower case
-    std::wstring wsearchedname;
-    if (!Utf8toWStr(_searchedname, wsearchedname))
-        return true;
-
-    wstrToLower(wsearchedname);
-
-    bool result = auctionHouse->BuildListAuctionItems(data, plr,
-                  wsearchedname, _listfrom, _levelmin, _levelmax, _usable,
-                  _auctionSlotID, _auctionMainCategory, _auctionSubCategory, _quality,
-                  count, totalcount, _getAll, _sortOrder);
-
-    if (!result)
-        return false;
+    AuctionHouseSnapshot::BuildListAuctionItems(data, query, entries, count, totalcount);
 
     data.put<uint32>(0, count);
     data << (uint32) totalcount;
     data << (uint32) 300; // clientside search cooldown [ms] (gray search button)
-    plr->GetSession()->SendPacket(&data);
 
+    AsyncAuctionListingMgr::PostReply(_playerguid, _creatureguid, std::move(data));
     return true;
 }
+
+AuctionHouseSnapshotPtr AsyncAuctionListingMgr::GetSnapshot(AuctionHouseObject* auctionHouse)
+{
+    std::lock_guard<std::mutex> guard(auctionSnapshotsLock);
+
+    SnapshotInfo& info = auctionSnapshots[auctionHouse];
+    info.Requested = true;
+    return info.Snapshot;
+}
+
+void AsyncAuctionListingMgr::UpdateSnapshots()
+{
+    std::vector<std::pair<AuctionHouseObject*, AuctionHouseSnapshotPtr>> outdated;
+    {
+        std::lock_guard<std::mutex> guard(auctionSnapshotsLock);
+
+        uint32 now = getMSTime();
+        for (auto& [auctionHouse, info] : auctionSnapshots)
+        {
+            if (!info.Requested)
+                continue;
+
+            if (info.Snapshot && (!auctionHouse->HasChangedItemTemplates()
+                || getMSTimeDiff(info.BuildTime, now) < sWorld->getIntConfig(CONFIG_AUCTION_LISTING_SNAPSHOT_INTERVAL)))
+                continue;
+
+            info.Requested = false;
+            outdated.emplace_back(auctionHouse, info.Snapshot);
+        }
+    }
+
+    // auctions are only modified by this thread, the copies are made without blocking the listing thread.
+    // Only the first snapshot copies the whole auction house, later ones copy the changed item templates
+    std::unordered_set<uint32> changedItemTemplates;
+    for (auto const& [auctionHouse, previous] : outdated)
+    {
+        auctionHouse->TakeChangedItemTemplates(changedItemTemplates);
+
+        AuctionHouseSnapshotPtr snapshot = previous
+            ? std::make_shared<AuctionHouseSnapshot const>(*previous, *auctionHouse, changedItemTemplates)
+            : std::make_shared<AuctionHouseSnapshot const>(*auctionHouse);
+
+        std::lock_guard<std::mutex> guard(auctionSnapshotsLock);
+        SnapshotInfo& info = auctionSnapshots[auctionHouse];
+        info.Snapshot = std::move(snapshot);
+        info.BuildTime = getMSTime();
+    }
+}
+
+void AsyncAuctionListingMgr::PostReply(ObjectGuid playerGuid, ObjectGuid creatureGuid, WorldPacket&& packet)
+{
+    std::lock_guard<std::mutex> guard(auctionListingRepliesLock);
+    auctionListingReplies.push_back({ playerGuid, creatureGuid, std::move(packet) });
+}
+
+void AsyncAuctionListingMgr::SendReplies()
+{
+    std::vector<Reply> replies;
+    {
+        std::lock_guard<std::mutex> guard(auctionListingRepliesLock);
+        replies.swap(auctionListingReplies);
+    }
+
+    for (Reply& reply : replies)
+    {
+        Player* plr = ObjectAccessor::FindPlayer(reply.PlayerGuid);
+        if (!plr || !plr->IsInWorld() || plr->IsDuringRemoveFromWorld() || plr->IsBeingTeleported())
+            continue;
+
+        // the player may have walked away from the auctioneer while the search ran
+        if (!plr->GetNPCIfCanInteractWith(reply.CreatureGuid, UNIT_NPC_FLAG_AUCTIONEER))
+            continue;
+
+        plr->GetSession()->SendPacket(&reply.Packet);
+    }
+}
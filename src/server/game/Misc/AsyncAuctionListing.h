@@ -19,8 +19,11 @@
 #define __ASYNCAUCTIONLISTING_H
 
 #include "AuctionHouseMgr.h"
+#include "AuctionHouseSnapshot.h"
 
+#include <atomic>
 #include <mutex>
+#include <unordered_map>
 
 class AuctionListOwnerItemsDelayEvent : public BasicEvent
 {
@@ -41,16 +44,21 @@ private:
 class AuctionListItemsDelayEvent
 {
 public:
-    AuctionListItemsDelayEvent(uint32 msTimer, ObjectGuid playerguid, ObjectGuid creatureguid, std::string searchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax,
+    AuctionListItemsDelayEvent(uint32 msTimer, ObjectGuid playerguid, ObjectGuid creatureguid, AuctionHouseObject* auctionHouse, LocaleConstant dbLocale, LocaleConstant dbcLocale, std::string searchedname, uint32 listfrom, uint8 levelmin, uint8 levelmax,
         uint8 usable, uint32 auctionSlotID, uint32 auctionMainCategory, uint32 auctionSubCategory, uint32 quality, uint8 getAll, AuctionSortOrderVector sortOrder) :
-        _msTimer(msTimer), _playerguid(playerguid), _creatureguid(creatureguid), _searchedname(searchedname), _listfrom(listfrom), _levelmin(levelmin), _levelmax(levelmax),_usable(usable),
+        _msTimer(msTimer), _playerguid(playerguid), _creatureguid(creatureguid), _auctionHouse(auctionHouse), _dbLocale(dbLocale), _dbcLocale(dbcLocale), _searchedname(searchedname), _listfrom(listfrom), _levelmin(levelmin), _levelmax(levelmax),_usable(usable),
         _auctionSlotID(auctionSlotID), _auctionMainCategory(auctionMainCategory), _auctionSubCategory(auctionSubCategory), _quality(quality), _getAll(getAll), _sortOrder(sortOrder) { }
 
+    // runs on the auction listing thread, searches the snapshot of the auction house and posts the reply to the world thread.
+    // Returns false while the world thread has not built a snapshot yet
     bool Execute();
 
     uint32 _msTimer;
     ObjectGuid _playerguid;
     ObjectGuid _creatureguid;
+    AuctionHouseObject* _auctionHouse;
+    LocaleConstant _dbLocale;
+    LocaleConstant _dbcLocale;
     std::string _searchedname;
     uint32 _listfrom;
     uint8 _levelmin;
@@ -68,8 +76,8 @@ class AsyncAuctionListingMgr
 {
 public:
     static void Update(uint32 diff) { auctionListingDiff += diff; }
-    static uint32 GetDiff() { return auctionListingDiff; }
-    static void ResetDiff() { auctionListingDiff = 0; }
+    // returns the time passed since the last call
+    static uint32 ConsumeDiff() { return auctionListingDiff.exchange(0); }
     static bool IsAuctionListingAllowed() { return auctionListingAllowed; }
     static void SetAuctionListingAllowed(bool a) { auctionListingAllowed = a; }
 
@@ -78,13 +86,44 @@ public:
     static std::mutex& GetLock() { return auctionListingLock; }
     static std::mutex& GetTempLock() { return auctionListingTempLock; }
 
+    // listing thread: returns the latest snapshot of the auction house and asks the world thread for a
+    // newer one. Null until the first snapshot of that auction house was built
+    static AuctionHouseSnapshotPtr GetSnapshot(AuctionHouseObject* auctionHouse);
+
+    // world thread, inside its auction section: updates the requested snapshots whose auction house changed,
+    // at most once per AuctionHouse.ListingSnapshotInterval
+    static void UpdateSnapshots();
+
+    // listing results are sent by the world thread, inside its auction section
+    static void PostReply(ObjectGuid playerGuid, ObjectGuid creatureGuid, WorldPacket&& packet);
+    static void SendReplies();
+
 private:
-    static uint32 auctionListingDiff;
-    static bool auctionListingAllowed;
+    struct SnapshotInfo
+    {
+        AuctionHouseSnapshotPtr Snapshot;
+        uint32 BuildTime = 0;
+        bool Requested = false;
+    };
+
+    struct Reply
+    {
+        ObjectGuid PlayerGuid;
+        ObjectGuid CreatureGuid;
+        WorldPacket Packet;
+    };
+
+
+    static std::atomic<uint32> auctionListingDiff;
+    static std::atomic<bool> auctionListingAllowed;
     static std::list<AuctionListItemsDelayEvent> auctionListingList;
     static std::list<AuctionListItemsDelayEvent> auctionListingListTemp;
     static std::mutex auctionListingLock;
     static std::mutex auctionListingTempLock;
+    static std::unordered_map<AuctionHouseObject*, SnapshotInfo> auctionSnapshots;
+    static std::mutex auctionSnapshotsLock;
+    static std::vector<Reply> auctionListingReplies;
+    static std::mutex auctionListingRepliesLock;
 };
 
 #endif
@@ -30,7 +30,7 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false), _forceDestination(false),
     _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
     _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _pathCache(nullptr)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
@@ -40,6 +40,7 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
         MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
         _navMesh = mmap->GetNavMesh(mapId);
         _navMeshQuery = mmap->GetNavMeshQuery(mapId, _source->GetInstanceId());
+        _pathCache = mmap->GetPathCache(mapId);
     }
 
     CreateFilter();
@@ -469,15 +470,28 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                startPoly,          // start polygon
-                endPoly,            // end polygon
-                startPoint,         // start position
-                endPoint,           // end position
-                &_filter,           // polygon search filter
-                _pathPolyRefs,     // [out] path
-                (int*)&_polyLength,
-                MAX_PATH_LENGTH);   // max number of polygons in output path
+            MMAP::NavMeshPathKey cacheKey = { startPoly, endPoly, _filter.getIncludeFlags(), _filter.getExcludeFlags() };
+            uint32 cacheGeneration = 0;
+            if (_pathCache && _pathCache->Find(cacheKey, _pathPolyRefs, _polyLength, MAX_PATH_LENGTH, cacheGeneration))
+            {
+                dtResult = DT_SUCCESS;
+            }
+            else
+            {
+                dtResult = _navMeshQuery->findPath(
+                    startPoly,          // start polygon
+                    endPoly,            // end polygon
+                    startPoint,         // start position
+                    endPoint,           // end position
+                    &_filter,           // polygon search filter
+                    _pathPolyRefs,     // [out] path
+                    (int*)&_polyLength,
+                    MAX_PATH_LENGTH);   // max number of polygons in output path
+
+                // only complete corridors can be reused by other callers
+                if (_pathCache && dtStatusSucceed(dtResult) && !dtStatusDetail(dtResult, DT_PARTIAL_RESULT))
+                    _pathCache->Store(cacheKey, cacheGeneration, _pathPolyRefs, _polyLength);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
@@ -84,6 +84,7 @@ class PathGenerator
         void SetUseRaycast(bool useRaycast) { _useRaycast = useRaycast; }
 
         // result getters
+        WorldObject const* GetSource() const { return _source; }
         G3D::Vector3 const& GetStartPosition() const { return _startPosition; }
         G3D::Vector3 const& GetEndPosition() const { return _endPosition; }
         G3D::Vector3 const& GetActualEndPosition() const { return _actualEndPosition; }
@@ -148,6 +149,7 @@ class PathGenerator
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
         dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        MMAP::NavMeshPathCache* _pathCache;     // poly corridors recently found on this nav mesh
 
         dtQueryFilterExt _filter;  // use single filter for all movements, update it when needed
 
@@ -0,0 +1,66 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathRequestQueue.h"
+#include "Object.h"
+#include "PathGenerator.h"
+
+PathRequest::PathRequest(PathGenerator* path, G3D::Vector3 const& dest, bool forceDest) :
+    _path(path), _dest(dest), _forceDest(forceDest), _done(false), _result(false), _submitTime(std::chrono::steady_clock::now())
+{
+}
+
+PathRequestQueue::~PathRequestQueue()
+{
+    for (std::weak_ptr<PathRequest> const& weakRequest : _requests)
+        if (PathRequestPtr request = weakRequest.lock())
+            request->_done = true;
+}
+
+PathRequestPtr PathRequestQueue::Submit(PathGenerator* path, float destX, float destY, float destZ, bool forceDest /*= false*/)
+{
+    PathRequestPtr request = std::make_shared<PathRequest>(path, G3D::Vector3(destX, destY, destZ), forceDest);
+    _requests.push_back(request);
+    return request;
+}
+
+void PathRequestQueue::Update(Map const* map, uint32 quota)
+{
+    _lastSolved = 0;
+    _lastMaxLatency = Milliseconds::zero();
+
+    TimePoint now = std::chrono::steady_clock::now();
+    while (!_requests.empty() && (!quota || _lastSolved < quota))
+    {
+        PathRequestPtr request = _requests.front().lock();
+        _requests.pop_front();
+
+        // cancelled by the submitter
+        if (!request)
+            continue;
+
+        // owner left this map in the meantime, the generator is not ours to touch anymore
+        WorldObject const* owner = request->_path->GetSource();
+        if (owner->IsInWorld() && owner->FindMap() == map)
+            request->_result = request->_path->CalculatePath(request->_dest.x, request->_dest.y, request->_dest.z, request->_forceDest);
+
+        request->_done = true;
+
+        _lastMaxLatency = std::max(_lastMaxLatency, std::chrono::duration_cast<Milliseconds>(now - request->_submitTime));
+        ++_lastSolved;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PATH_REQUEST_QUEUE_H
+#define _PATH_REQUEST_QUEUE_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <G3D/Vector3.h>
+#include <deque>
+#include <memory>
+
+class Map;
+class PathGenerator;
+
+// A deferred PathGenerator::CalculatePath call, solved by the map of the owner on a later update.
+// The submitter keeps the only strong reference, dropping it cancels the request.
+class PathRequest
+{
+    friend class PathRequestQueue;
+
+public:
+    PathRequest(PathGenerator* path, G3D::Vector3 const& dest, bool forceDest);
+
+    [[nodiscard]] bool IsDone() const { return _done; }
+    // result of CalculatePath, only meaningful once IsDone() - the path itself is read from the generator
+    [[nodiscard]] bool GetResult() const { return _result; }
+
+private:
+    PathGenerator* _path;
+    G3D::Vector3 _dest;
+    bool _forceDest;
+    bool _done;
+    bool _result;
+    TimePoint _submitTime;
+};
+
+typedef std::shared_ptr<PathRequest> PathRequestPtr;
+
+// Per map queue of path requests, so that a burst of expensive detour searches
+// (many creatures picking new random points at once) is spread over several map updates.
+// This only batches the searches: they are still solved on the thread updating the owning map,
+// like everything else here.
+class PathRequestQueue
+{
+public:
+    PathRequestQueue() : _lastMaxLatency(0), _lastSolved(0) { }
+    // requests still queued when the map goes away are completed as failed, so no submitter waits forever
+    ~PathRequestQueue();
+
+    PathRequestPtr Submit(PathGenerator* path, float destX, float destY, float destZ, bool forceDest = false);
+
+    // solves at most 'quota' pending requests of the given map, 0 means no limit
+    void Update(Map const* map, uint32 quota);
+
+    [[nodiscard]] std::size_t GetPendingCount() const { return _requests.size(); }
+    // statistics of the last Update call
+    [[nodiscard]] uint32 GetLastSolvedCount() const { return _lastSolved; }
+    [[nodiscard]] Milliseconds GetLastMaxLatency() const { return _lastMaxLatency; }
+
+private:
+    std::deque<std::weak_ptr<PathRequest>> _requests;
+    Milliseconds _lastMaxLatency;
+    uint32 _lastSolved;
+};
+
+#endif
@@ -41,6 +41,12 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
     if (creature->_moveState != MAP_OBJECT_CELL_MOVE_NONE)
         return;
 
+    // wait for the map to solve the ground path requested earlier
+    if (_pathRequest && !_pathRequest->IsDone())
+        return;
+
+    PathRequestPtr pathRequest = std::move(_pathRequest);
+
     if (_validPointsVector[_currentPoint].empty())
     {
         if (_currentPoint == RANDOM_POINTS_NUMBER) // cant go anywhere from initial position, lets stay
@@ -58,8 +64,17 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
         return;
     }
 
-    uint8 random = urand(0, _validPointsVector[_currentPoint].size() - 1);
-    std::vector<uint8>::iterator randomIter = _validPointsVector[_currentPoint].begin() + random;
+    std::vector<uint8>::iterator randomIter;
+    if (pathRequest)
+    {
+        // resume with the point the path was requested for
+        randomIter = std::find(_validPointsVector[_currentPoint].begin(), _validPointsVector[_currentPoint].end(), _pathRequestPoint);
+        if (randomIter == _validPointsVector[_currentPoint].end())
+            return;
+    }
+    else
+        randomIter = _validPointsVector[_currentPoint].begin() + urand(0, _validPointsVector[_currentPoint].size() - 1);
+
     uint8 newPoint = *randomIter;
     uint16 pathIdx = uint16(_currentPoint * RANDOM_POINTS_NUMBER + newPoint);
 
@@ -134,7 +149,15 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
         }
         else // ground
         {
-            bool result = _pathGenerator->CalculatePath(x, y, levelZ, false);
+            // let the map solve the path, it is picked up by one of the next updates
+            if (!pathRequest)
+            {
+                _pathRequest = map->GetPathRequestQueue().Submit(_pathGenerator, x, y, levelZ);
+                _pathRequestPoint = newPoint;
+                return;
+            }
+
+            bool result = pathRequest->GetResult();
             if (result && !(_pathGenerator->GetPathType() & PATHFIND_NOPATH))
             {
                 // generated path is too long
@@ -241,6 +264,7 @@ void RandomMovementGenerator<Creature>::DoInitialize(Creature* creature)
 
     if (!_pathGenerator)
         _pathGenerator = new PathGenerator(creature);
+    _pathRequest.reset();
     creature->AddUnitState(UNIT_STATE_ROAMING | UNIT_STATE_ROAMING_MOVE);
 }
 
@@ -253,6 +277,7 @@ void RandomMovementGenerator<Creature>::DoReset(Creature* creature)
 template<>
 void RandomMovementGenerator<Creature>::DoFinalize(Creature* creature)
 {
+    _pathRequest.reset();
     creature->ClearUnitState(UNIT_STATE_ROAMING | UNIT_STATE_ROAMING_MOVE);
     creature->SetWalk(false);
 }
@@ -20,6 +20,7 @@
 
 #include "MovementGenerator.h"
 #include "PathGenerator.h"
+#include "PathRequestQueue.h"
 
 #define RANDOM_POINTS_NUMBER        12
 #define RANDOM_LINKS_COUNT          7
@@ -31,7 +32,7 @@ template<class T>
 class RandomMovementGenerator : public MovementGeneratorMedium< T, RandomMovementGenerator<T> >
 {
 public:
-    RandomMovementGenerator(float wanderDistance = 0.0f) : _nextMoveTime(0), _moveCount(0), _wanderDistance(wanderDistance), _pathGenerator(nullptr), _currentPoint(RANDOM_POINTS_NUMBER)
+    RandomMovementGenerator(float wanderDistance = 0.0f) : _nextMoveTime(0), _moveCount(0), _wanderDistance(wanderDistance), _pathGenerator(nullptr), _currentPoint(RANDOM_POINTS_NUMBER), _pathRequestPoint(RANDOM_POINTS_NUMBER)
     {
         _initialPosition.Relocate(0.0f, 0.0f, 0.0f, 0.0f);
         _destinationPoints.reserve(RANDOM_POINTS_NUMBER);
@@ -65,6 +66,8 @@ private:
     std::vector<G3D::Vector3> _destinationPoints;
     std::vector<uint8> _validPointsVector[RANDOM_POINTS_NUMBER + 1];
     uint8 _currentPoint;
+    PathRequestPtr _pathRequest;          // ground path to _pathRequestPoint being solved by the map
+    uint8 _pathRequestPoint;
     std::map<uint16, Movement::PointsArray> _preComputedPaths;
     Position _initialPosition, _currDestPosition;
 };
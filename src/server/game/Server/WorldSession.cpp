@@ -208,15 +208,31 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (!OnSendPacket(packet))
+        return;
+
+    m_Socket->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!OnSendPacket(packet.get()))
+        return;
+
+    m_Socket->SendPacket(packet);
+}
+
+bool WorldSession::OnSendPacket(WorldPacket const* packet)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         LOG_ERROR("network.opcode", "%s send NULL_OPCODE", GetPlayerInfo().c_str());
-        return;
+        return false;
     }
 
     if (!m_Socket)
-        return;
+        return false;
 
 #if defined(ACORE_DEBUG)
     // Code for network use statistic
@@ -258,11 +274,11 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
 #ifdef ELUNA
     if (!sEluna->OnPacketSend(this, *packet))
-        return;
+        return false;
 #endif
 
     LOG_TRACE("network.opcode", "S->C: %s %s", GetPlayerInfo().c_str(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())).c_str());
-    m_Socket->SendPacket(*packet);
+    return true;
 }
 
 /// Add an incoming packet to the queue
@@ -255,6 +255,8 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    // sends a packet broadcast to many sessions, the payload is shared by all their sockets
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
     void SendNotification(const char* format, ...) ATTR_PRINTF(2, 3);
     void SendNotification(uint32 string_id, ...);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
@@ -1038,6 +1040,9 @@ private:
     bool recoveryItem(Item* pItem);
 
     // logging helper
+    // statistics, logging and script hooks of outgoing packets, returns false if the packet must not be sent
+    bool OnSendPacket(WorldPacket const* packet);
+
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason);
     void LogUnprocessedTail(WorldPacket* packet);
 
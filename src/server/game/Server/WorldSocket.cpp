@@ -35,7 +35,8 @@
 using boost::asio::ip::tcp;
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
-    : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _sendBufferSize(4096)
+    : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _sendBufferSize(4096),
+    _flushPending(false)
 {
     Acore::Crypto::GetRandomBytes(_authSeed);
     _headerBuffer.Resize(sizeof(ClientPktHeader));
@@ -80,49 +81,69 @@ void WorldSocket::CheckIpCallback(PreparedQueryResult result)
 }
 
 bool WorldSocket::Update()
+{
+    // outgoing packets are flushed as soon as they are queued (see SendPacket),
+    // this periodic pass only picks up anything left behind
+    FlushBufferQueue();
+
+    if (!BaseSocket::Update())
+        return false;
+
+    _queryProcessor.ProcessReadyCallbacks();
+
+    return true;
+}
+
+void WorldSocket::FlushBufferQueue()
 {
     EncryptablePacket* queued;
+    if (!_bufferQueue.Dequeue(queued))
+        return;
+
     MessageBuffer buffer(_sendBufferSize);
-    while (_bufferQueue.Dequeue(queued))
+    do
     {
-        ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+        WorldPacket const& packet = queued->GetPacket();
+        ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
         if (queued->NeedsEncryption())
             _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-        if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
+        if (buffer.GetRemainingSpace() < packet.size() + header.getHeaderLength())
         {
             QueuePacket(std::move(buffer));
             buffer.Resize(_sendBufferSize);
         }
 
-        if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
+        if (buffer.GetRemainingSpace() >= packet.size() + header.getHeaderLength())
         {
             buffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                buffer.Write(queued->contents(), queued->size());
+            if (!packet.empty())
+                buffer.Write(packet.contents(), packet.size());
         }
         else    // single packet larger than 4096 bytes
         {
-            MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
+            MessageBuffer packetBuffer(packet.size() + header.getHeaderLength());
             packetBuffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                packetBuffer.Write(queued->contents(), queued->size());
+            if (!packet.empty())
+                packetBuffer.Write(packet.contents(), packet.size());
 
             QueuePacket(std::move(packetBuffer));
         }
 
         delete queued;
-    }
+    } while (_bufferQueue.Dequeue(queued));
 
     if (buffer.GetActiveSize() > 0)
         QueuePacket(std::move(buffer));
+}
 
-    if (!BaseSocket::Update())
-        return false;
-
-    _queryProcessor.ProcessReadyCallbacks();
+void WorldSocket::HandleFlush()
+{
+    // cleared before draining, packets queued from here on post a new flush
+    _flushPending = false;
 
-    return true;
+    FlushBufferQueue();
+    BaseSocket::Update();
 }
 
 void WorldSocket::HandleSendAuthSession()
@@ -420,7 +441,27 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     if (sPacketLog->CanLogPacket())
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
-    _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+    QueueSendPacket(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+}
+
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    QueueSendPacket(new EncryptablePacket(std::move(packet), _authCrypt.IsInitialized()));
+}
+
+void WorldSocket::QueueSendPacket(EncryptablePacket* packet)
+{
+    _bufferQueue.Enqueue(packet);
+
+    // coalesce bursts, only the first packet since the last flush wakes the network thread
+    if (!_flushPending.exchange(true))
+        PostToNetworkThread(std::bind(&WorldSocket::HandleFlush, shared_from_this()));
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
@@ -30,19 +30,29 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptablePacket : public WorldPacket
+class EncryptablePacket
 {
 public:
-    EncryptablePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptablePacket(WorldPacket const& packet, bool encrypt) : _packet(packet), _encrypt(encrypt)
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // packet broadcast to many sockets, the payload is shared instead of copied for every recipient
+    EncryptablePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : _sharedPacket(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    WorldPacket const& GetPacket() const { return _sharedPacket ? *_sharedPacket : _packet; }
+
     bool NeedsEncryption() const { return _encrypt; }
 
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    WorldPacket _packet;
+    std::shared_ptr<WorldPacket const> _sharedPacket;
     bool _encrypt;
 };
 
@@ -79,6 +89,7 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
@@ -99,6 +110,14 @@ protected:
 private:
     void CheckIpCallback(PreparedQueryResult result);
 
+    /// moves packets from _bufferQueue into the socket write queue, must run on the network thread
+    void FlushBufferQueue();
+
+    /// flush posted by SendPacket when the first packet was queued since the last flush
+    void HandleFlush();
+
+    void QueueSendPacket(EncryptablePacket* packet);
+
     /// writes network.opcode log
     /// accessing WorldSession is not threadsafe, only do it when holding _worldSessionLock
     void LogOpcodeText(OpcodeClient opcode, std::unique_lock<std::mutex> const& guard) const;
@@ -127,6 +146,7 @@ private:
     MessageBuffer _packetBuffer;
     MPSCQueue<EncryptablePacket, &EncryptablePacket::SocketQueueLink> _bufferQueue;
     std::size_t _sendBufferSize;
+    std::atomic<bool> _flushPending;
 
     QueryCallbackProcessor _queryProcessor;
     std::string _ipCountry;
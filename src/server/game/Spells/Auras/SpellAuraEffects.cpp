@@ -4014,6 +4014,7 @@ void AuraEffect::HandleAuraModStat(AuraApplication const* aurApp, uint8 mode, bo
         return;
 
     Unit* target = aurApp->GetTarget();
+    StatUpdateBatch batch(target);
 
     if (GetMiscValue() < -2 || GetMiscValue() > 4)
     {
@@ -4040,6 +4041,7 @@ void AuraEffect::HandleModPercentStat(AuraApplication const* aurApp, uint8 mode,
         return;
 
     Unit* target = aurApp->GetTarget();
+    StatUpdateBatch batch(target);
 
     if (GetMiscValue() < -1 || GetMiscValue() > 4)
     {
@@ -4138,6 +4140,7 @@ void AuraEffect::HandleModTotalPercentStat(AuraApplication const* aurApp, uint8
         return;
 
     Unit* target = aurApp->GetTarget();
+    StatUpdateBatch batch(target);
 
     if (GetMiscValue() < -1 || GetMiscValue() > 4)
     {
@@ -439,8 +439,8 @@ public:
     template<class SEARCHER> void SearchTargets(SEARCHER& searcher, uint32 containerMask, Unit* referer, Position const* pos, float radius);
 
     WorldObject* SearchNearbyTarget(float range, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList = nullptr);
-    void SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
-    void SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, SpellTargetSelectionCategories selectCategory, ConditionList* condList, bool isChainHeal);
+    void SearchAreaTargets(std::vector<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
+    void SearchChainTargets(std::vector<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, SpellTargetSelectionCategories selectCategory, ConditionList* condList, bool isChainHeal);
 
     SpellCastResult prepare(SpellCastTargets const* targets, AuraEffect const* triggeredByAura = nullptr);
     void cancel(bool bySelf = false);
@@ -571,7 +571,7 @@ public:
 
     // xinef: moved to public
     void LoadScripts();
-    std::list<TargetInfo>* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
+    std::vector<TargetInfo>* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
 
     [[nodiscard]] uint32 GetTriggeredByAuraTickNumber() const { return m_triggeredByAuraSpell.tickNumber; }
 
@@ -660,7 +660,7 @@ public:
     // *****************************************
     // Spell target subsystem
     // *****************************************
-    std::list<TargetInfo> m_UniqueTargetInfo;
+    std::vector<TargetInfo> m_UniqueTargetInfo;
     uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
 
     struct GOTargetInfo
@@ -670,14 +670,14 @@ public:
         uint8  effectMask: 8;
         bool   processed: 1;
     };
-    std::list<GOTargetInfo> m_UniqueGOTargetInfo;
+    std::vector<GOTargetInfo> m_UniqueGOTargetInfo;
 
     struct ItemTargetInfo
     {
         Item*  item;
         uint8 effectMask;
     };
-    std::list<ItemTargetInfo> m_UniqueItemInfo;
+    std::vector<ItemTargetInfo> m_UniqueItemInfo;
 
     SpellDestination m_destTargets[MAX_SPELL_EFFECTS];
 
@@ -715,7 +715,7 @@ public:
     void CallScriptBeforeHitHandlers(SpellMissInfo missInfo);
     void CallScriptOnHitHandlers();
     void CallScriptAfterHitHandlers();
-    void CallScriptObjectAreaTargetSelectHandlers(std::list<WorldObject*>& targets, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType);
+    void CallScriptObjectAreaTargetSelectHandlers(std::vector<WorldObject*>& targets, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType);
     void CallScriptObjectTargetSelectHandlers(WorldObject*& target, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType);
     void CallScriptDestinationTargetSelectHandlers(SpellDestination& target, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType);
     bool CheckScriptEffectImplicitTargets(uint32 effIndex, uint32 effIndexToCheck);
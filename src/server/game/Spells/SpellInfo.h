@@ -309,7 +309,9 @@ private:
     static std::array<StaticData, TOTAL_SPELL_EFFECTS> _data;
 };
 
-class SpellInfo
+// Fields read by cast, aura and proc code come first so they share the leading cache lines,
+// item requirements and client data follow the effects.
+class alignas(64) SpellInfo
 {
 public:
     uint32 Id;
@@ -364,18 +366,6 @@ public:
     SpellRangeEntry const* RangeEntry;
     float  Speed;
     uint32 StackAmount;
-    std::array<uint32, 2> Totem;
-    std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
-    std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
-    int32  EquippedItemClass;
-    int32  EquippedItemSubClassMask;
-    int32  EquippedItemInventoryTypeMask;
-    std::array<uint32, 2> TotemCategory;
-    std::array<uint32, 2> SpellVisual;
-    uint32 SpellIconID;
-    uint32 ActiveIconID;
-    std::array<char const*, 16> SpellName;
-    std::array<char const*, 16> Rank;
     uint32 MaxTargetLevel;
     uint32 MaxAffectedTargets;
     uint32 SpellFamilyName;
@@ -384,7 +374,6 @@ public:
     uint32 PreventionType;
     int32  AreaGroupId;
     uint32 SchoolMask;
-    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
     uint32 ExplicitTargetMask;
     SpellChainNode const* ChainEntry;
 
@@ -396,6 +385,21 @@ public:
     bool _isCritCapable;
     bool _requireCooldownInfo;
 
+    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
+
+    std::array<uint32, 2> Totem;
+    std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
+    std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
+    int32  EquippedItemClass;
+    int32  EquippedItemSubClassMask;
+    int32  EquippedItemInventoryTypeMask;
+    std::array<uint32, 2> TotemCategory;
+    std::array<uint32, 2> SpellVisual;
+    uint32 SpellIconID;
+    uint32 ActiveIconID;
+    std::array<char const*, 16> SpellName;
+    std::array<char const*, 16> Rank;
+
     SpellInfo(SpellEntry const* spellEntry);
     ~SpellInfo();
 
@@ -2694,10 +2694,21 @@ void SpellMgr::LoadSpellInfoStore()
     UnloadSpellInfoStore();
     mSpellInfoMap.resize(sSpellStore.GetNumRows(), nullptr);
 
+    uint32 spellCount = 0;
+    for (uint32 i = 0; i < sSpellStore.GetNumRows(); ++i)
+        if (sSpellStore.LookupEntry(i))
+            ++spellCount;
+
+    // SpellEffectInfo keeps a pointer to its SpellInfo, the storage must never reallocate
+    mSpellInfoStorage.reserve(spellCount);
+
     for (uint32 i = 0; i < sSpellStore.GetNumRows(); ++i)
     {
         if (SpellEntry const* spellEntry = sSpellStore.LookupEntry(i))
-            mSpellInfoMap[i] = new SpellInfo(spellEntry);
+        {
+            ASSERT(mSpellInfoStorage.size() < mSpellInfoStorage.capacity());
+            mSpellInfoMap[i] = &mSpellInfoStorage.emplace_back(spellEntry);
+        }
     }
 
     LOG_INFO("server.loading", ">> Loaded spell custom attributes in %u ms", GetMSTimeDiffToNow(oldMSTime));
@@ -2706,10 +2717,8 @@ void SpellMgr::LoadSpellInfoStore()
 
 void SpellMgr::UnloadSpellInfoStore()
 {
-    for (uint32 i = 0; i < mSpellInfoMap.size(); ++i)
-        delete mSpellInfoMap[i];
-
     mSpellInfoMap.clear();
+    mSpellInfoStorage.clear();
 }
 
 void SpellMgr::UnloadSpellInfoImplicitTargetConditionLists()
@@ -788,6 +788,7 @@ private:
     PetLevelupSpellMap         mPetLevelupSpellMap;
     PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
     SpellInfoMap               mSpellInfoMap;
+    std::vector<SpellInfo>     mSpellInfoStorage;       // all SpellInfo objects back to back in spell id order, mSpellInfoMap points into it
     TalentAdditionalSet        mTalentSpellAdditionalSet;
 };
 
@@ -245,6 +245,7 @@ enum WorldIntConfigs
     CONFIG_START_GM_LEVEL,
     CONFIG_GROUP_VISIBILITY,
     CONFIG_MAIL_DELIVERY_DELAY,
+    CONFIG_MAIL_EXPIRY_BATCH_SIZE,
     CONFIG_UPTIME_UPDATE,
     CONFIG_SKILL_CHANCE_ORANGE,
     CONFIG_SKILL_CHANCE_YELLOW,
@@ -393,6 +394,8 @@ enum WorldIntConfigs
     CONFIG_LOOT_NEED_BEFORE_GREED_ILVL_RESTRICTION,
     CONFIG_LFG_MAX_KICK_COUNT,
     CONFIG_LFG_KICK_PREVENTION_TIMER,
+    CONFIG_MAP_PATH_REQUESTS_PER_UPDATE,
+    CONFIG_AUCTION_LISTING_SNAPSHOT_INTERVAL,
     INT_CONFIG_VALUE_COUNT
 };
 
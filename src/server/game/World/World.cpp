@@ -663,6 +663,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_TRADE_LEVEL_REQ]                  = sConfigMgr->GetOption<int32>("LevelReq.Trade", 1);
     m_int_configs[CONFIG_TICKET_LEVEL_REQ]                 = sConfigMgr->GetOption<int32>("LevelReq.Ticket", 1);
     m_int_configs[CONFIG_AUCTION_LEVEL_REQ]                = sConfigMgr->GetOption<int32>("LevelReq.Auction", 1);
+    m_int_configs[CONFIG_AUCTION_LISTING_SNAPSHOT_INTERVAL] = sConfigMgr->GetOption<int32>("AuctionHouse.ListingSnapshotInterval", 1000);
     m_int_configs[CONFIG_MAIL_LEVEL_REQ]                   = sConfigMgr->GetOption<int32>("LevelReq.Mail", 1);
     m_bool_configs[CONFIG_ALLOW_PLAYER_COMMANDS]           = sConfigMgr->GetOption<bool>("AllowPlayerCommands", 1);
     m_bool_configs[CONFIG_PRESERVE_CUSTOM_CHANNELS]        = sConfigMgr->GetOption<bool>("PreserveCustomChannels", false);
@@ -936,6 +937,13 @@ void World::LoadConfigSettings(bool reload)
 
     m_int_configs[CONFIG_MAIL_DELIVERY_DELAY]   = sConfigMgr->GetOption<int32>("MailDeliveryDelay", HOUR);
 
+    m_int_configs[CONFIG_MAIL_EXPIRY_BATCH_SIZE] = sConfigMgr->GetOption<int32>("MailExpiryBatchSize", 500);
+    if (m_int_configs[CONFIG_MAIL_EXPIRY_BATCH_SIZE] == 0)
+    {
+        LOG_ERROR("server.loading", "MailExpiryBatchSize (0) must be > 0. Using 500 instead.");
+        m_int_configs[CONFIG_MAIL_EXPIRY_BATCH_SIZE] = 500;
+    }
+
     m_int_configs[CONFIG_UPTIME_UPDATE]         = sConfigMgr->GetOption<int32>("UpdateUptimeInterval", 10);
     if (int32(m_int_configs[CONFIG_UPTIME_UPDATE]) <= 0)
     {
@@ -1286,6 +1294,7 @@ void World::LoadConfigSettings(bool reload)
 
     VMAP::VMapFactory::createOrGetVMapMgr()->setEnableLineOfSightCalc(enableLOS);
     VMAP::VMapFactory::createOrGetVMapMgr()->setEnableHeightCalc(enableHeight);
+    VMAP::VMapFactory::createOrGetVMapMgr()->SetQueryCacheSize(sConfigMgr->GetOption<uint32>("vmap.QueryCacheSize", 8192));
     LOG_INFO("server.loading", "WORLD: VMap support included. LineOfSight:%i, getHeight:%i, indoorCheck:%i PetLOS:%i", enableLOS, enableHeight, enableIndoor, enablePetLOS);
 
     m_bool_configs[CONFIG_PET_LOS]            = sConfigMgr->GetOption<bool>("vmap.petLOS", true);
@@ -1344,6 +1353,7 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_PDUMP_NO_PATHS]     = sConfigMgr->GetOption<bool>("PlayerDump.DisallowPaths", true);
     m_bool_configs[CONFIG_PDUMP_NO_OVERWRITE] = sConfigMgr->GetOption<bool>("PlayerDump.DisallowOverwrite", true);
     m_bool_configs[CONFIG_ENABLE_MMAPS]       = sConfigMgr->GetOption<bool>("MoveMaps.Enable", true);
+    m_int_configs[CONFIG_MAP_PATH_REQUESTS_PER_UPDATE] = sConfigMgr->GetOption<int32>("MoveMaps.PathRequestsPerUpdate", 50);
     MMAP::MMapFactory::InitializeDisabledMaps();
 
     // Wintergrasp
@@ -2311,6 +2321,8 @@ void World::Update(uint32 diff)
         }
 
         AsyncAuctionListingMgr::Update(diff);
+        AsyncAuctionListingMgr::UpdateSnapshots();
+        AsyncAuctionListingMgr::SendReplies();
 
         if (m_gameTime > mail_expire_check_timer)
         {
@@ -2318,6 +2330,8 @@ void World::Update(uint32 diff)
             mail_expire_check_timer = m_gameTime + 6 * 3600;
         }
 
+        sObjectMgr->UpdateExpiredMails();
+
         {
             /// <li> Handle session updates when the timer has passed
             METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
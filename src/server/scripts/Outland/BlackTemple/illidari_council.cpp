@@ -628,8 +628,8 @@ public:
             }
 
             float pct = (_sharedHealth / _sharedHealthMax) * 100.0f;
-            std::list<TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-            for (std::list<TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+            std::vector<TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+            for (std::vector<TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                 if (Creature* target = ObjectAccessor::GetCreature(*GetCaster(), ihit->targetGUID))
                 {
                     target->LowerPlayerDamageReq(target->GetMaxHealth());
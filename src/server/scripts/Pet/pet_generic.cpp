@@ -545,8 +545,8 @@ class spell_pet_gen_valkyr_guardian_smite : public SpellScript
     {
         if (GetHitUnit() != GetCaster())
         {
-            std::list<TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-            for (std::list<TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+            std::vector<TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+            for (std::vector<TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                 if (ihit->targetGUID == GetCaster()->GetGUID())
                     ihit->damage = -int32(GetHitDamage() * 0.25f);
         }
@@ -369,8 +369,8 @@ class spell_dk_chains_of_ice : public SpellScript
     {
         if (Unit* target = GetExplTargetUnit())
         {
-            std::list<TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-            for (std::list<TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+            std::vector<TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+            for (std::vector<TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                 if (ihit->missCondition == SPELL_MISS_NONE && ihit->targetGUID == target->GetGUID())
                     GetCaster()->CastSpell(target, 55095 /*SPELL_FROST_FEVER*/, true);
         }
@@ -494,8 +494,8 @@ class spell_dk_rune_of_the_fallen_crusader : public SpellScript
 
     void RecalculateDamage()
     {
-        std::list<TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-        for (std::list<TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+        std::vector<TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+        for (std::vector<TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
             if (ihit->targetGUID == GetCaster()->GetGUID())
                 ihit->crit = roll_chance_f(GetCaster()->GetFloatValue(PLAYER_CRIT_PERCENTAGE));
     }
@@ -45,8 +45,8 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
     _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
     // load strings from dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
-        _stringPool.push_back(stringBlock);
+    if (dbc.AutoProduceStrings(_fileFormat, _dataTable))
+        _fileData.push_back(dbc.GetFileData());
 
     // error in dbc file at loading if nullptr
     return indexTable != nullptr;
@@ -64,9 +64,9 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
     if (!dbc.Load(path, _fileFormat))
         return false;
 
-    // load strings from another locale dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
-        _stringPool.push_back(stringBlock);
+    // load strings from another locale dbc data, the file is only kept if it filled a missing string
+    if (dbc.AutoProduceStrings(_fileFormat, _dataTable))
+        _fileData.push_back(dbc.GetFileData());
 
     return true;
 }
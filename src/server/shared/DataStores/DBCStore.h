@@ -24,6 +24,7 @@
 #include <G3D/AABox.h>
 #include <G3D/Vector3.h>
 #include <cstring>
+#include <memory>
 #include <vector>
 
  // Structures for M4 file. Source: https://wowdev.wiki
@@ -162,6 +163,7 @@ protected:
     char const* _fileFormat;
     char* _dataTable;
     std::vector<char*> _stringPool;
+    std::vector<std::shared_ptr<void const>> _fileData;     // dbc files the strings point into
     uint32 _indexTableSize;
 };
 
@@ -22,6 +22,7 @@
 #include "MessageBuffer.h"
 #include <atomic>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
 #include <functional>
 #include <memory>
 #include <queue>
@@ -164,6 +165,13 @@ protected:
         return false;
     }
 
+    /// Runs the handler on the network thread owning this socket
+    template<typename Handler>
+    void PostToNetworkThread(Handler&& handler)
+    {
+        boost::asio::post(_socket.get_executor(), std::forward<Handler>(handler));
+    }
+
     void SetNoDelay(bool enable)
     {
         boost::system::error_code err;
@@ -36,6 +36,8 @@
 #include "DeadlineTimer.h"
 #include "GitRevision.h"
 #include "IoContext.h"
+#include "MMapFactory.h"
+#include "MMapMgr.h"
 #include "MapMgr.h"
 #include "Metric.h"
 #include "MySQLThreading.h"
@@ -50,6 +52,8 @@
 #include "ScriptMgr.h"
 #include "SecretMgr.h"
 #include "SharedDefines.h"
+#include "VMapFactory.h"
+#include "VMapMgr2.h"
 #include "World.h"
 #include "WorldSocket.h"
 #include "WorldSocketMgr.h"
@@ -305,6 +309,29 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        VMAP::VMapFactory::createOrGetVMapMgr()->VisitQueryCacheStats([](uint32 mapId, VMAP::MapQueryCacheStats& stats)
+        {
+            VMAP::MapQueryCacheStats::Counters counters = stats.Take();
+            if (!counters.LineOfSightHits && !counters.LineOfSightMisses && !counters.HeightHits && !counters.HeightMisses)
+                return;
+
+            METRIC_VALUE("vmap_los_cache_hits", counters.LineOfSightHits, METRIC_TAG("map_id", std::to_string(mapId)));
+            METRIC_VALUE("vmap_los_cache_misses", counters.LineOfSightMisses, METRIC_TAG("map_id", std::to_string(mapId)));
+            METRIC_VALUE("vmap_height_cache_hits", counters.HeightHits, METRIC_TAG("map_id", std::to_string(mapId)));
+            METRIC_VALUE("vmap_height_cache_misses", counters.HeightMisses, METRIC_TAG("map_id", std::to_string(mapId)));
+        });
+
+        MMAP::MMapFactory::createOrGetMMapMgr()->VisitPathCacheStats([](uint32 mapId, MMAP::NavMeshPathCacheStats& stats)
+        {
+            uint64 hits = stats.Hits.exchange(0, std::memory_order_relaxed);
+            uint64 misses = stats.Misses.exchange(0, std::memory_order_relaxed);
+            if (!hits && !misses)
+                return;
+
+            METRIC_VALUE("mmap_path_cache_hits", hits, METRIC_TAG("map_id", std::to_string(mapId)));
+            METRIC_VALUE("mmap_path_cache_misses", misses, METRIC_TAG("map_id", std::to_string(mapId)));
+        });
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -723,42 +750,34 @@ void AuctionListingRunnable()
 
     while (!World::IsStopped())
     {
-        if (AsyncAuctionListingMgr::IsAuctionListingAllowed())
-        {
-            uint32 diff = AsyncAuctionListingMgr::GetDiff();
-            AsyncAuctionListingMgr::ResetDiff();
+        uint32 diff = AsyncAuctionListingMgr::ConsumeDiff();
 
-            if (AsyncAuctionListingMgr::GetTempList().size() || AsyncAuctionListingMgr::GetList().size())
+        if (AsyncAuctionListingMgr::GetTempList().size() || AsyncAuctionListingMgr::GetList().size())
+        {
             {
-                std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetLock());
-
-                {
-                    std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetTempLock());
-
-                    for (auto const& delayEvent : AsyncAuctionListingMgr::GetTempList())
-                        AsyncAuctionListingMgr::GetList().emplace_back(delayEvent);
-
-                    AsyncAuctionListingMgr::GetTempList().clear();
-                }
+                std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetTempLock());
 
-                for (auto& itr : AsyncAuctionListingMgr::GetList())
-                {
-                    if (itr._msTimer <= diff)
-                        itr._msTimer = 0;
-                    else
-                        itr._msTimer -= diff;
-                }
+                for (auto const& delayEvent : AsyncAuctionListingMgr::GetTempList())
+                    AsyncAuctionListingMgr::GetList().emplace_back(delayEvent);
 
-                for (std::list<AuctionListItemsDelayEvent>::iterator itr = AsyncAuctionListingMgr::GetList().begin(); itr != AsyncAuctionListingMgr::GetList().end(); ++itr)
-                {
-                    if ((*itr)._msTimer != 0)
-                        continue;
+                AsyncAuctionListingMgr::GetTempList().clear();
+            }
 
-                    if ((*itr).Execute())
-                        AsyncAuctionListingMgr::GetList().erase(itr);
+            for (auto& itr : AsyncAuctionListingMgr::GetList())
+            {
+                if (itr._msTimer <= diff)
+                    itr._msTimer = 0;
+                else
+                    itr._msTimer -= diff;
+            }
 
-                    break;
-                }
+            // searches run on auction house snapshots, they no longer have to wait for a window in World::Update
+            for (std::list<AuctionListItemsDelayEvent>::iterator itr = AsyncAuctionListingMgr::GetList().begin(); itr != AsyncAuctionListingMgr::GetList().end();)
+            {
+                if ((*itr)._msTimer == 0 && (*itr).Execute())
+                    itr = AsyncAuctionListingMgr::GetList().erase(itr);
+                else
+                    ++itr;
             }
         }
         std::this_thread::sleep_for(1ms);
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapQueryCache.h"
+#include "gtest/gtest.h"
+
+using VMAP::MapQueryCache;
+
+TEST(MapQueryCacheTest, Disabled)
+{
+    MapQueryCache cache(0);
+    uint64 key;
+
+    EXPECT_FALSE(cache.IsEnabled());
+    EXPECT_FALSE(cache.GetHeightKey(G3D::Vector3(1.0f, 2.0f, 3.0f), 10.0f, key));
+    EXPECT_FALSE(cache.GetLineOfSightKey(G3D::Vector3(1.0f, 2.0f, 3.0f), G3D::Vector3(4.0f, 5.0f, 6.0f), key));
+}
+
+TEST(MapQueryCacheTest, StoreAndFind)
+{
+    MapQueryCache cache(64);
+    uint64 heightKey, losKey;
+    float height;
+    bool inLoS;
+
+    ASSERT_TRUE(cache.GetHeightKey(G3D::Vector3(100.0f, 200.0f, 30.0f), 50.0f, heightKey));
+    ASSERT_TRUE(cache.GetLineOfSightKey(G3D::Vector3(100.0f, 200.0f, 30.0f), G3D::Vector3(110.0f, 210.0f, 31.0f), losKey));
+    EXPECT_FALSE(cache.FindHeight(heightKey, height));
+    EXPECT_FALSE(cache.FindLineOfSight(losKey, inLoS));
+
+    cache.StoreHeight(heightKey, 28.5f);
+    cache.StoreLineOfSight(losKey, true);
+
+    ASSERT_TRUE(cache.FindHeight(heightKey, height));
+    EXPECT_EQ(height, 28.5f);
+    ASSERT_TRUE(cache.FindLineOfSight(losKey, inLoS));
+    EXPECT_TRUE(inLoS);
+}
+
+TEST(MapQueryCacheTest, HeightKeyCollision)
+{
+    MapQueryCache cache(16);
+    float height;
+
+    // same slot, keys only differ in their upper bits
+    uint64 key1 = 0x0000000100000005ULL;
+    uint64 key2 = 0x0000000200000005ULL;
+    uint64 key3 = 0x0000000100000015ULL;
+
+    cache.StoreHeight(key1, 1.0f);
+    EXPECT_FALSE(cache.FindHeight(key2, height));
+    EXPECT_FALSE(cache.FindHeight(key3, height));
+    ASSERT_TRUE(cache.FindHeight(key1, height));
+    EXPECT_EQ(height, 1.0f);
+
+    cache.StoreHeight(key2, 2.0f);
+    EXPECT_FALSE(cache.FindHeight(key1, height));
+    ASSERT_TRUE(cache.FindHeight(key2, height));
+    EXPECT_EQ(height, 2.0f);
+}
+
+TEST(MapQueryCacheTest, LineOfSightKeyCollision)
+{
+    MapQueryCache cache(16);
+    bool inLoS;
+
+    uint64 key1 = 0x0000000100000014ULL;
+    uint64 key2 = 0x0000000200000014ULL;
+
+    cache.StoreLineOfSight(key1, false);
+    EXPECT_FALSE(cache.FindLineOfSight(key2, inLoS));
+    ASSERT_TRUE(cache.FindLineOfSight(key1, inLoS));
+    EXPECT_FALSE(inLoS);
+}
+
+TEST(MapQueryCacheTest, InvalidateStartsNewGeneration)
+{
+    MapQueryCache cache(64);
+    G3D::Vector3 pos(100.0f, 200.0f, 30.0f);
+    G3D::Vector3 target(110.0f, 210.0f, 31.0f);
+    uint64 heightKey, losKey;
+    float height;
+    bool inLoS;
+
+    ASSERT_TRUE(cache.GetHeightKey(pos, 50.0f, heightKey));
+    ASSERT_TRUE(cache.GetLineOfSightKey(pos, target, losKey));
+    cache.StoreHeight(heightKey, 28.5f);
+    cache.StoreLineOfSight(losKey, true);
+
+    cache.Invalidate();
+
+    uint64 newHeightKey, newLosKey;
+    ASSERT_TRUE(cache.GetHeightKey(pos, 50.0f, newHeightKey));
+    ASSERT_TRUE(cache.GetLineOfSightKey(pos, target, newLosKey));
+    EXPECT_NE(newHeightKey, heightKey);
+    EXPECT_NE(newLosKey, losKey);
+    EXPECT_FALSE(cache.FindHeight(newHeightKey, height));
+    EXPECT_FALSE(cache.FindLineOfSight(newLosKey, inLoS));
+}
+
+TEST(MapQueryCacheTest, Stats)
+{
+    VMAP::MapQueryCacheStats stats;
+    MapQueryCache cache(64, &stats);
+    float height;
+    bool inLoS;
+
+    uint64 heightKey = 0x0000000100000005ULL;
+    uint64 losKey = 0x0000000100000014ULL;
+
+    EXPECT_FALSE(cache.FindHeight(heightKey, height));
+    EXPECT_FALSE(cache.FindLineOfSight(losKey, inLoS));
+    cache.StoreHeight(heightKey, 1.0f);
+    cache.StoreLineOfSight(losKey, true);
+    EXPECT_TRUE(cache.FindHeight(heightKey, height));
+    EXPECT_TRUE(cache.FindHeight(heightKey, height));
+    EXPECT_TRUE(cache.FindLineOfSight(losKey, inLoS));
+
+    VMAP::MapQueryCacheStats::Counters counters = stats.Take();
+    EXPECT_EQ(counters.HeightHits, 2u);
+    EXPECT_EQ(counters.HeightMisses, 1u);
+    EXPECT_EQ(counters.LineOfSightHits, 1u);
+    EXPECT_EQ(counters.LineOfSightMisses, 1u);
+
+    counters = stats.Take();
+    EXPECT_EQ(counters.HeightHits + counters.HeightMisses + counters.LineOfSightHits + counters.LineOfSightMisses, 0u);
+}
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldModel.h"
+#include "gtest/gtest.h"
+#include <random>
+
+using G3D::Ray;
+using G3D::Vector3;
+using VMAP::MeshTriangle;
+
+namespace
+{
+    // reference result, every entry tested on its own
+    bool IntersectTrianglesScalar(std::vector<MeshTriangle> const& triangles, uint32 const* entries, uint32 count, std::vector<Vector3> const& points, Ray const& ray, float& distance)
+    {
+        bool hit = false;
+        for (uint32 i = 0; i < count; ++i)
+            hit |= VMAP::IntersectTriangle(triangles[entries[i]], points.begin(), ray, distance);
+        return hit;
+    }
+
+    void CheckLeaf(std::vector<MeshTriangle> const& triangles, uint32 const* entries, uint32 count, std::vector<Vector3> const& points, Ray const& ray, float distance)
+    {
+        float scalarDistance = distance;
+        float leafDistance = distance;
+        bool scalarHit = IntersectTrianglesScalar(triangles, entries, count, points, ray, scalarDistance);
+        bool leafHit = VMAP::IntersectTriangles(triangles.begin(), entries, count, points.begin(), ray, leafDistance);
+
+        ASSERT_EQ(scalarHit, leafHit);
+        ASSERT_EQ(scalarDistance, leafDistance);
+    }
+}
+
+TEST(WorldModelTest, IntersectTrianglesMatchesScalarOnRandomRays)
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> inside(0.0f, 10.0f);
+    std::uniform_real_distribution<float> around(-5.0f, 15.0f);
+    std::uniform_int_distribution<uint32> leafSize(1, 8);
+
+    std::vector<Vector3> points(64);
+    for (Vector3& point : points)
+        point = Vector3(inside(rng), inside(rng), inside(rng));
+
+    std::uniform_int_distribution<uint32> pointIndex(0, uint32(points.size() - 1));
+    std::vector<MeshTriangle> triangles(32);
+    for (MeshTriangle& triangle : triangles)
+        triangle = MeshTriangle(pointIndex(rng), pointIndex(rng), pointIndex(rng));
+
+    std::uniform_int_distribution<uint32> triangleIndex(0, uint32(triangles.size() - 1));
+    uint32 hits = 0;
+    for (uint32 i = 0; i < 200000; ++i)
+    {
+        Vector3 origin(around(rng), around(rng), around(rng));
+        Vector3 target(inside(rng), inside(rng), inside(rng));
+        Ray ray = Ray::fromOriginAndDirection(origin, (target - origin).direction());
+
+        uint32 entries[8];
+        uint32 count = leafSize(rng);
+        for (uint32 j = 0; j < count; ++j)
+            entries[j] = triangleIndex(rng);
+
+        // also limit the distance so far hits get rejected by the distance check
+        float distance = (i & 1) ? 100.0f : (target - origin).length();
+        CheckLeaf(triangles, entries, count, points, ray, distance);
+
+        float hitDistance = distance;
+        if (IntersectTrianglesScalar(triangles, entries, count, points, ray, hitDistance))
+            ++hits;
+    }
+
+    // make sure the rays do not all miss
+    EXPECT_GT(hits, 20000u);
+}
+
+TEST(WorldModelTest, IntersectTrianglesMatchesScalarOnEdgeCases)
+{
+    // two triangles sharing an edge on the z = 0 plane, a degenerate one and one parallel to the x axis
+    std::vector<Vector3> points =
+    {
+        Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(1.0f, 1.0f, 0.0f),
+        Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 1.0f, 1.0f)
+    };
+    std::vector<MeshTriangle> triangles =
+    {
+        MeshTriangle(0, 1, 2), MeshTriangle(1, 3, 2), MeshTriangle(0, 0, 0), MeshTriangle(0, 2, 5), MeshTriangle(0, 4, 5)
+    };
+    uint32 const entries[5] = { 0, 1, 2, 3, 4 };
+
+    std::vector<Ray> rays =
+    {
+        Ray::fromOriginAndDirection(Vector3(0.5f, 0.5f, 5.0f), Vector3(0.0f, 0.0f, -1.0f)),   // on the shared edge
+        Ray::fromOriginAndDirection(Vector3(0.0f, 0.0f, 5.0f), Vector3(0.0f, 0.0f, -1.0f)),   // on a vertex
+        Ray::fromOriginAndDirection(Vector3(1.0f, 1.0f, 5.0f), Vector3(0.0f, 0.0f, -1.0f)),   // on the far corner
+        Ray::fromOriginAndDirection(Vector3(2.0f, 2.0f, 5.0f), Vector3(0.0f, 0.0f, -1.0f)),   // outside
+        Ray::fromOriginAndDirection(Vector3(-1.0f, 0.5f, 0.0f), Vector3(1.0f, 0.0f, 0.0f)),   // in the plane
+        Ray::fromOriginAndDirection(Vector3(0.5f, 0.5f, -5.0f), Vector3(0.0f, 0.0f, 1.0f)),   // from below
+        Ray::fromOriginAndDirection(Vector3(0.25f, 0.25f, 0.0f), Vector3(0.0f, 0.0f, -1.0f)), // starting on the plane
+        Ray::fromOriginAndDirection(Vector3(-1.0f, 0.5f, 0.5f), Vector3(1.0f, 0.0f, 0.0f))    // through the x = 0 triangles
+    };
+
+    for (Ray const& ray : rays)
+    {
+        for (uint32 count = 1; count <= 5; ++count)
+        {
+            CheckLeaf(triangles, entries, count, points, ray, 100.0f);
+            CheckLeaf(triangles, entries + 5 - count, count, points, ray, 5.0f);
+        }
+    }
+}
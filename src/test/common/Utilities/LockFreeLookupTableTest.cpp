@@ -0,0 +1,133 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LockFreeLookupTable.h"
+#include "gtest/gtest.h"
+#include <thread>
+#include <vector>
+
+TEST(LockFreeLookupTableTest, InsertFind)
+{
+    Acore::LockFreeLookupTable<int> table;
+    int a = 1, b = 2;
+
+    table.Insert(10, &a);
+    table.Insert(20, &b);
+
+    EXPECT_EQ(table.Find(10), &a);
+    EXPECT_EQ(table.Find(20), &b);
+    EXPECT_EQ(table.Find(30), nullptr);
+    EXPECT_EQ(table.Size(), 2u);
+
+    table.Insert(10, &b);
+    EXPECT_EQ(table.Find(10), &b);
+    EXPECT_EQ(table.Size(), 2u);
+}
+
+TEST(LockFreeLookupTableTest, Erase)
+{
+    Acore::LockFreeLookupTable<int> table;
+    int a = 1, b = 2;
+
+    table.Insert(10, &a);
+    table.Insert(20, &b);
+    table.Erase(10);
+    table.Erase(30);
+
+    EXPECT_EQ(table.Find(10), nullptr);
+    EXPECT_EQ(table.Find(20), &b);
+    EXPECT_EQ(table.Size(), 1u);
+
+    table.Insert(10, &a);
+    EXPECT_EQ(table.Find(10), &a);
+}
+
+TEST(LockFreeLookupTableTest, RebuildKeepsEntries)
+{
+    Acore::LockFreeLookupTable<uint64> table;
+    std::vector<uint64> values(1000);
+
+    for (uint64 i = 0; i < values.size(); ++i)
+    {
+        values[i] = i;
+        table.Insert(i + 1, &values[i]);
+        if (i % 3 == 0)
+            table.Erase(i + 1);
+    }
+
+    for (uint64 i = 0; i < values.size(); ++i)
+        EXPECT_EQ(table.Find(i + 1), i % 3 == 0 ? nullptr : &values[i]);
+
+    EXPECT_EQ(table.Size(), 666u);
+}
+
+TEST(LockFreeLookupTableTest, RetiredTableOutlivesRunningLookup)
+{
+    Acore::LockFreeLookupTable<int> table;
+    std::vector<int> values(200);
+
+    {
+        // a lookup in progress on this thread keeps every table retired from now on alive
+        Acore::LookupTableEpoch::ReadGuard guard;
+        for (int i = 0; i < 200; ++i)
+            table.Insert(i + 1, &values[i]);
+
+        table.Reclaim();
+        EXPECT_GT(table.RetiredCount(), 0u);
+    }
+
+    table.Reclaim();
+    EXPECT_EQ(table.RetiredCount(), 0u);
+}
+
+TEST(LockFreeLookupTableTest, ConcurrentFindDuringWrites)
+{
+    Acore::LockFreeLookupTable<uint64> table;
+    std::vector<uint64> values(4096);
+    for (uint64 i = 0; i < values.size(); ++i)
+        values[i] = i + 1;
+
+    std::atomic<bool> stop(false);
+    std::atomic<uint32> wrongValues(0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&]()
+        {
+            while (!stop.load(std::memory_order_relaxed))
+                for (uint64 key = 1; key <= values.size(); ++key)
+                    if (uint64* value = table.Find(key))
+                        if (*value != key)
+                            ++wrongValues;
+        });
+    }
+
+    for (int round = 0; round < 20; ++round)
+    {
+        for (uint64 i = 0; i < values.size(); ++i)
+            table.Insert(values[i], &values[i]);
+
+        for (uint64 i = 0; i < values.size(); ++i)
+            table.Erase(values[i]);
+    }
+
+    stop = true;
+    for (std::thread& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(wrongValues.load(), 0u);
+}
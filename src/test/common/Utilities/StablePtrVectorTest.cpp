@@ -0,0 +1,153 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StablePtrVector.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace
+{
+    std::vector<int*> Elements(Acore::StablePtrVector<int> const& container)
+    {
+        return std::vector<int*>(container.begin(), container.end());
+    }
+}
+
+TEST(StablePtrVectorTest, PushBackAndRemove)
+{
+    int values[4];
+    Acore::StablePtrVector<int> container;
+
+    for (int& value : values)
+        container.push_back(&value);
+
+    container.remove(&values[1]);
+    EXPECT_EQ(container.size(), 3u);
+    EXPECT_EQ(Elements(container), (std::vector<int*>{ &values[0], &values[2], &values[3] }));
+
+    container.remove(&values[3]);
+    EXPECT_EQ(container.back(), &values[2]);
+    EXPECT_EQ(container.front(), &values[0]);
+}
+
+TEST(StablePtrVectorTest, RemoveDuringIteration)
+{
+    int values[5];
+    Acore::StablePtrVector<int> container;
+    for (int& value : values)
+        container.push_back(&value);
+
+    // removing the current element and one that was not visited yet
+    std::vector<int*> visited;
+    for (int* value : container)
+    {
+        visited.push_back(value);
+        if (value == &values[1])
+        {
+            container.remove(&values[1]);
+            container.remove(&values[3]);
+        }
+    }
+
+    EXPECT_EQ(visited, (std::vector<int*>{ &values[0], &values[1], &values[2], &values[4] }));
+    EXPECT_EQ(container.size(), 3u);
+    EXPECT_TRUE(container.NeedsCompaction());
+
+    container.compact();
+    EXPECT_FALSE(container.NeedsCompaction());
+    EXPECT_EQ(Elements(container), (std::vector<int*>{ &values[0], &values[2], &values[4] }));
+}
+
+TEST(StablePtrVectorTest, RemoveEverythingDuringIteration)
+{
+    int values[3];
+    Acore::StablePtrVector<int> container;
+    for (int& value : values)
+        container.push_back(&value);
+
+    for (int* value : container)
+        container.remove(value);
+
+    EXPECT_TRUE(container.empty());
+    EXPECT_TRUE(container.begin() == container.end());
+}
+
+TEST(StablePtrVectorTest, AppendDuringIteration)
+{
+    int values[5];
+    Acore::StablePtrVector<int> container;
+    container.push_back(&values[0]);
+    container.push_back(&values[1]);
+
+    // range-for caches end(), entries appended during the loop are not visited by it
+    std::vector<int*> visited;
+    for (int* value : container)
+    {
+        visited.push_back(value);
+        if (value == &values[0])
+            container.push_back(&values[2]);
+    }
+
+    EXPECT_EQ(visited, (std::vector<int*>{ &values[0], &values[1] }));
+    EXPECT_EQ(container.size(), 3u);
+
+    // a loop that asks for end() on every step also visits them, like std::list
+    visited.clear();
+    for (auto itr = container.begin(); itr != container.end(); ++itr)
+    {
+        visited.push_back(*itr);
+        if (*itr == &values[2])
+            container.push_back(&values[3]);
+    }
+
+    EXPECT_EQ(visited, (std::vector<int*>{ &values[0], &values[1], &values[2], &values[3] }));
+}
+
+TEST(StablePtrVectorTest, AppendAndRemoveDuringIteration)
+{
+    int values[4];
+    Acore::StablePtrVector<int> container;
+    container.push_back(&values[0]);
+    container.push_back(&values[1]);
+
+    std::vector<int*> visited;
+    for (auto itr = container.begin(); itr != container.end(); ++itr)
+    {
+        visited.push_back(*itr);
+        if (*itr == &values[0])
+        {
+            container.push_back(&values[2]);
+            container.push_back(&values[3]);
+            container.remove(&values[2]);
+        }
+    }
+
+    EXPECT_EQ(visited, (std::vector<int*>{ &values[0], &values[1], &values[3] }));
+}
+
+TEST(StablePtrVectorTest, ReverseIteration)
+{
+    int values[4];
+    Acore::StablePtrVector<int> container;
+    for (int& value : values)
+        container.push_back(&value);
+
+    container.remove(&values[2]);
+
+    std::vector<int*> visited(container.rbegin(), container.rend());
+    EXPECT_EQ(visited, (std::vector<int*>{ &values[3], &values[1], &values[0] }));
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskScheduler.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(TaskSchedulerTest, EqualEndKeepsScheduleOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+
+    scheduler.Schedule(2s, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(1s, [&](TaskContext) { order.push_back(2); });
+    scheduler.Schedule(2s, [&](TaskContext) { order.push_back(3); });
+    scheduler.Schedule(1s, [&](TaskContext) { order.push_back(4); });
+
+    scheduler.Update(2s);
+
+    EXPECT_EQ(order, (std::vector<int>{ 2, 4, 1, 3 }));
+}
+
+TEST(TaskSchedulerTest, Repeat)
+{
+    TaskScheduler scheduler;
+    uint32 repeated = 0;
+
+    scheduler.Schedule(1s, [&](TaskContext context)
+    {
+        repeated = context.GetRepeatCounter();
+        if (repeated < 3)
+            context.Repeat();
+    });
+
+    for (int i = 0; i < 10; ++i)
+        scheduler.Update(1s);
+
+    EXPECT_EQ(repeated, 3u);
+}
+
+TEST(TaskSchedulerTest, ScheduleFromContext)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+
+    scheduler.Schedule(1s, [&](TaskContext context)
+    {
+        order.push_back(1);
+        context.Schedule(1s, [&](TaskContext) { order.push_back(2); });
+    });
+
+    scheduler.Update(1s);
+    EXPECT_EQ(order, (std::vector<int>{ 1 }));
+
+    scheduler.Update(1s);
+    EXPECT_EQ(order, (std::vector<int>{ 1, 2 }));
+}
+
+TEST(TaskSchedulerTest, CancelGroup)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+
+    scheduler.Schedule(1s, 1, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(1s, 2, [&](TaskContext) { order.push_back(2); });
+    scheduler.Schedule(2s, 1, [&](TaskContext) { order.push_back(3); });
+
+    scheduler.CancelGroup(1);
+    scheduler.Update(2s);
+
+    EXPECT_EQ(order, (std::vector<int>{ 2 }));
+}
+
+TEST(TaskSchedulerTest, DelayGroup)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+
+    scheduler.Schedule(1s, 1, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(2s, 2, [&](TaskContext) { order.push_back(2); });
+    scheduler.Schedule(3s, [&](TaskContext) { order.push_back(3); });
+
+    scheduler.DelayGroup(1, 2s);
+
+    scheduler.Update(2s);
+    EXPECT_EQ(order, (std::vector<int>{ 2 }));
+
+    scheduler.Update(1s);
+    EXPECT_EQ(order, (std::vector<int>{ 2, 3, 1 }));
+}